@@ -0,0 +1,209 @@
+// bench/bench_quad.c
+//
+// Benchmark das regras de quadratura: para cada regra, integrando e n,
+// mede tempo total, ns por avaliação de f e erro absoluto. Saída em CSV
+// (uma linha por ponto) para montar curvas erro x avaliações.
+//   $ make bench                     (gera out/bench_quad.csv)
+//   $ ./lab1_bench [saida.csv] [--quick]
+#define _POSIX_C_SOURCE 199309L
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "integral.h"
+#include "integral_par.h"
+#include "integral_gk.h"
+#include "integral_romberg.h"
+#include "integral_gl.h"
+#include "integral_de.h"
+#include "integral_sweep.h"
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846264338327950288419716939937510
+#endif
+
+// Tempo mínimo medido por ponto: repete a integral até passar disso
+#define MIN_BENCH_SECONDS 0.02
+
+static double now_s(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// ---------- Integrandos com custos diferentes ----------
+
+static double f_x2(double x, void *ctx) { (void)ctx; return x * x; }
+static double f_sin(double x, void *ctx) { (void)ctx; return sin(x); }
+
+// Série de K senos: custo proporcional a K
+typedef struct { int K; } HeavyCtx;
+static double f_heavy(double x, void *ctx) {
+    int K = ((HeavyCtx *)ctx)->K;
+    double s = 0.0;
+    for (int k = 1; k <= K; ++k) s += sin(k * x) / k;
+    return s;
+}
+// ∫_0^pi Σ sin(kx)/k dx = Σ (1 - cos(k pi)) / k^2
+static double heavy_exact(int K) {
+    double s = 0.0;
+    for (int k = 1; k <= K; ++k) s += (k % 2 != 0) ? 2.0 / ((double)k * k) : 0.0;
+    return s;
+}
+
+typedef struct {
+    const char *name;
+    const char *cost;   // "barato" | "medio" | "caro"
+    Func1D f;
+    void  *ctx;
+    double a, b, exact;
+    size_t n_max;       // limite do sweep para manter o tempo total razoável
+} Integrand;
+
+// ---------- Regras com n fixo ----------
+
+typedef double (*IntegratorFn)(Func1D, void *, double, double, size_t, IntegralStatus *);
+
+static double trap_par(Func1D f, void *c, double a, double b, size_t n, IntegralStatus *st) {
+    return trapezoidal_rule_par(f, c, a, b, n, 0, st);
+}
+static double simp_par(Func1D f, void *c, double a, double b, size_t n, IntegralStatus *st) {
+    return simpson_rule_par(f, c, a, b, n, 0, st);
+}
+static double gl4(Func1D f, void *c, double a, double b, size_t n, IntegralStatus *st) {
+    return gauss_legendre_rule(f, c, a, b, n / 4, 4, st);
+}
+static double gl8(Func1D f, void *c, double a, double b, size_t n, IntegralStatus *st) {
+    return gauss_legendre_rule(f, c, a, b, n / 8, 8, st);
+}
+static double gl16(Func1D f, void *c, double a, double b, size_t n, IntegralStatus *st) {
+    return gauss_legendre_rule(f, c, a, b, n / 16, 16, st);
+}
+
+// Varredura única com n/2 subintervalos (n+1 avaliações); devolve Simpson refinado
+static double all_rules(Func1D f, void *c, double a, double b, size_t n, IntegralStatus *st) {
+    IntegralAllRules R;
+    integral_all_rules(f, c, a, b, n / 2, &R, st);
+    return R.simpson_2n;
+}
+
+typedef struct {
+    const char  *name;
+    IntegratorFn fn;
+    int          extra_evals; // avaliações = n + extra_evals
+} FixedRule;
+
+static const FixedRule fixed_rules[] = {
+    {"riemann_left",     riemann_left,     0},
+    {"riemann_right",    riemann_right,    0},
+    {"riemann_midpoint", riemann_midpoint, 0},
+    {"trapezoidal",      trapezoidal_rule, 1},
+    {"simpson",          simpson_rule,     1},
+    {"trapezoidal_par",  trap_par,         1},
+    {"simpson_par",      simp_par,         1},
+    {"gauss_legendre_4", gl4,              0}, // n é o total de nós (n/ordem painéis)
+    {"gauss_legendre_8", gl8,              0},
+    {"gauss_legendre_16",gl16,             0},
+    {"all_rules",        all_rules,        1}, // todas as regras numa varredura
+};
+
+static void csv_row(FILE *fp, const char *rule, const Integrand *I, size_t n, size_t evals,
+                    double t_total, int reps, double result) {
+    double t = t_total / reps;
+    fprintf(fp, "%s,%s,%s,%zu,%zu,%.9f,%.3f,%.17g,%.6e\n",
+            rule, I->name, I->cost, n, evals, t, 1e9 * t / (double)evals,
+            result, fabs(result - I->exact));
+}
+
+static void bench_fixed(FILE *fp, const FixedRule *R, const Integrand *I) {
+    for (size_t n = 16; n <= I->n_max; n *= 4) {
+        IntegralStatus st;
+        double result = 0.0, t0 = now_s(), t = 0.0;
+        int reps = 0;
+        do {
+            result = R->fn(I->f, I->ctx, I->a, I->b, n, &st);
+            reps++;
+            t = now_s() - t0;
+        } while (t < MIN_BENCH_SECONDS);
+        if (st != INT_OK) continue;
+        csv_row(fp, R->name, I, n, n + (size_t)R->extra_evals, t, reps, result);
+    }
+}
+
+// ---------- Regras adaptativas: varre a tolerância ----------
+
+static void bench_adaptive(FILE *fp, const Integrand *I) {
+    for (double tol = 1e-2; tol >= 1e-13; tol *= 1e-1) {
+        IntegralStatus st;
+        double err = 0.0, result = 0.0, t0 = now_s(), t = 0.0;
+        size_t evals = 0;
+        int reps = 0;
+        do {
+            result = gauss_kronrod_adaptive(I->f, I->ctx, I->a, I->b, tol, 0.0, 1u << 24,
+                                            &err, &evals, &st);
+            reps++;
+            t = now_s() - t0;
+        } while (t < MIN_BENCH_SECONDS);
+        csv_row(fp, "gauss_kronrod", I, evals, evals, t, reps, result);
+
+        RombergState R;
+        reps = 0;
+        t0 = now_s();
+        do {
+            romberg_init(&R, I->f, I->ctx, I->a, I->b, &st);
+            result = romberg_refine_until(&R, tol, 0.0, 24, &err, &st);
+            reps++;
+            t = now_s() - t0;
+        } while (t < MIN_BENCH_SECONDS);
+        csv_row(fp, "romberg", I, R.n_evals, R.n_evals, t, reps, result);
+
+        reps = 0;
+        t0 = now_s();
+        do {
+            result = tanh_sinh_rule(I->f, I->ctx, I->a, I->b, tol, 0.0, DE_MAX_LEVEL, &err, &evals, &st);
+            reps++;
+            t = now_s() - t0;
+        } while (t < MIN_BENCH_SECONDS);
+        csv_row(fp, "tanh_sinh", I, evals, evals, t, reps, result);
+    }
+}
+
+int main(int argc, char **argv) {
+    const char *out_path = "out/bench_quad.csv";
+    int quick = 0;
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--quick") == 0) quick = 1;
+        else out_path = argv[i];
+    }
+
+    FILE *fp = fopen(out_path, "w");
+    if (!fp) { perror(out_path); return 1; }
+    fprintf(fp, "rule,integrand,cost,n,evals,time_s,ns_per_eval,result,abs_err\n");
+
+    HeavyCtx heavy = {.K = 64};
+    size_t big = quick ? ((size_t)1 << 14) : ((size_t)1 << 22);
+    Integrand integrands[] = {
+        {"x^2[0,1]",     "barato", f_x2,    NULL,   0.0, 1.0,  1.0 / 3.0,       big},
+        {"sin[0,pi]",    "medio",  f_sin,   NULL,   0.0, M_PI, 2.0,             big},
+        {"sin_k64[0,pi]","caro",   f_heavy, &heavy, 0.0, M_PI, heavy_exact(64), big / 16},
+    };
+    const size_t n_int = sizeof(integrands) / sizeof(integrands[0]);
+    const size_t n_rules = sizeof(fixed_rules) / sizeof(fixed_rules[0]);
+
+    for (size_t i = 0; i < n_int; ++i) {
+        printf("== %s (%s) ==\n", integrands[i].name, integrands[i].cost);
+        for (size_t r = 0; r < n_rules; ++r) {
+            bench_fixed(fp, &fixed_rules[r], &integrands[i]);
+            printf("  %-18s ok\n", fixed_rules[r].name);
+        }
+        bench_adaptive(fp, &integrands[i]);
+        printf("  %-18s ok\n", "adaptativos");
+        fflush(fp);
+    }
+
+    fclose(fp);
+    printf("OK: %s gerado.\n", out_path);
+    return 0;
+}
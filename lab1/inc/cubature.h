@@ -0,0 +1,59 @@
+// inc/cubature.h
+#ifndef CUBATURE_H
+#define CUBATURE_H
+
+#include "integral.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define CUBATURE_MAX_DIM 21     // limite da tabela de direções de Sobol
+#define CUBATURE_QMC_REPLICAS 8 // réplicas deslocadas do QMC (estimativa de erro)
+
+/*
+ * Integrando N-D em lote: avalia 'count' pontos de dimensão 'dim', com
+ * coordenadas em x[i*dim + d], e escreve out[i]. É chamado concorrentemente
+ * por várias threads (cada chamada com seu próprio bloco de pontos).
+ */
+typedef void (*FuncND)(const double *x, size_t count, unsigned dim, double *out, void *ctx);
+
+/*
+ * Progresso do QMC: chamado pela thread chamadora ao fim de cada rodada com
+ * o total de avaliações, a estimativa atual e o erro padrão estimado.
+ */
+typedef void (*CubatureReport)(size_t n_evals, double estimate, double err_est, void *user);
+
+/**
+ * Produto tensorial de Gauss-Legendre (boa escolha para dim baixa): cada eixo
+ * [lo[d], hi[d]] usa 'panels' painéis de 'order' nós, total (order*panels)^dim
+ * pontos, avaliados em blocos por 'nthreads' threads (0 = CPUs online).
+ * Resultado idêntico para qualquer número de threads.
+ * Se err_est != NULL a regra é repetida com ordem vizinha (order-1, ou order+1
+ * na ordem mínima) e *err_est = |diferença|; o custo entra em *n_evals.
+ * Erros: INT_ERR_DIM_INVALID, INT_ERR_ORDER_INVALID, INT_ERR_N_INVALID
+ * (panels = 0 ou nº de pontos estoura size_t), INT_ERR_NULL_FUNC, INT_ERR_ALLOC.
+ */
+double cubature_gauss(FuncND f, void *ctx, unsigned dim, const double *lo, const double *hi,
+                      unsigned order, size_t panels, unsigned nthreads,
+                      double *err_est, size_t *n_evals, IntegralStatus *st);
+
+/**
+ * Quasi-Monte Carlo com sequência de Sobol (dim alta, até CUBATURE_MAX_DIM).
+ * Usa CUBATURE_QMC_REPLICAS réplicas com deslocamento digital aleatório
+ * (semente fixa, resultado reprodutível); o erro é o erro padrão entre réplicas.
+ * As amostras são geradas em rodadas (n dobra a cada rodada) e avaliadas em
+ * blocos pelas threads; ao fim de cada rodada 'report' (opcional) é chamado.
+ * Para quando erro <= max(abs_tol, rel_tol*|estimativa|) ou ao esgotar max_evals.
+ * Status: INT_OK, INT_ERR_NOT_CONVERGED, INT_ERR_TOL_INVALID, INT_ERR_DIM_INVALID,
+ * INT_ERR_N_INVALID (max_evals menor que uma rodada), INT_ERR_NULL_FUNC, INT_ERR_ALLOC.
+ */
+double cubature_qmc(FuncND f, void *ctx, unsigned dim, const double *lo, const double *hi,
+                    size_t max_evals, double abs_tol, double rel_tol, unsigned nthreads,
+                    CubatureReport report, void *user,
+                    double *err_est, size_t *n_evals, IntegralStatus *st);
+
+#ifdef __cplusplus
+}
+#endif
+#endif // CUBATURE_H
@@ -14,7 +14,15 @@ typedef double (*Func1D)(double x, void *ctx);
 typedef enum {
     INT_OK = 0,
     INT_ERR_N_INVALID,   // n = 0, ou (no Simpson) n ímpar
-    INT_ERR_NULL_FUNC    // ponteiro de função nulo
+    INT_ERR_NULL_FUNC,   // ponteiro de função nulo
+    INT_ERR_ALLOC,       // falha de alocação (rotinas paralelas/adaptativas)
+    INT_ERR_TOL_INVALID, // tolerâncias abs/rel ambas <= 0 (ou negativas)
+    INT_ERR_NOT_CONVERGED, // tolerância não atingida dentro do orçamento (resultado ainda é retornado)
+    INT_ERR_ORDER_INVALID, // ordem de regra fora da faixa suportada
+    INT_ERR_DIM_INVALID,   // dimensão 0 ou acima do máximo (cubatura N-D, integrandos vetoriais)
+    INT_ERR_DATA,          // amostras inválidas (x não estritamente crescente, NaN)
+    INT_ERR_IO,            // falha ao abrir/ler arquivo de amostras
+    INT_ERR_RANGE          // ponto de consulta fora do domínio tabelado (ou domínio vazio)
 } IntegralStatus;
 
 // Util: retorna 0 em [a,a], suporta a>b (resultado com sinal correto)
@@ -0,0 +1,35 @@
+// inc/integral_batch.h
+#ifndef INTEGRAL_BATCH_H
+#define INTEGRAL_BATCH_H
+
+#include "integral.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Integração em lote: a mesma f e o mesmo n aplicados a m intervalos
+ * [a[i], b[i]] em uma única chamada. A validação (f, n, paridade) é feita
+ * uma vez só; out[i] recebe o resultado e st_out[i] (opcional) o status de
+ * cada intervalo. *st recebe INT_OK ou o erro que invalidou o lote inteiro
+ * (nesse caso out[] é preenchido com NAN).
+ *
+ * ctxs == NULL: todos os intervalos usam 'ctx'. Se, além disso, os
+ * intervalos têm o mesmo passo h e extremos alinhados numa grade comum
+ * (ex.: janelas deslizantes), f é avaliada UMA vez por nó da grade e os nós
+ * coincidentes são compartilhados entre intervalos.
+ * ctxs != NULL: ctxs[i] é o contexto do intervalo i; os nós são gerados e
+ * acumulados em layout SoA, intervalo a intervalo no laço interno.
+ */
+void simpson_rule_batch    (Func1D f, void *ctx, void *const *ctxs,
+                            const double *a, const double *b, size_t m, size_t n,
+                            double *out, IntegralStatus *st_out, IntegralStatus *st); // n PAR
+void trapezoidal_rule_batch(Func1D f, void *ctx, void *const *ctxs,
+                            const double *a, const double *b, size_t m, size_t n,
+                            double *out, IntegralStatus *st_out, IntegralStatus *st);
+
+#ifdef __cplusplus
+}
+#endif
+#endif // INTEGRAL_BATCH_H
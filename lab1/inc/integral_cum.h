@@ -0,0 +1,49 @@
+// inc/integral_cum.h
+#ifndef INTEGRAL_CUM_H
+#define INTEGRAL_CUM_H
+
+#include "integral.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Tabela da primitiva F(x) = ∫_lo^x f em n+1 nós igualmente espaçados de
+ * [lo,hi] (lo = min(a,b)). Cada painel é integrado por Simpson (nós + ponto
+ * médio, erro O(h^4)); F é a soma prefixada dos painéis. Também guarda f nos
+ * nós (F' = f), usada na interpolação de Hermite cúbica das consultas.
+ */
+typedef struct {
+    double  lo, hi, h;
+    size_t  n;   // nº de painéis
+    double *F;   // F[k] = ∫_lo^{x_k} f, k = 0..n
+    double *fx;  // f(x_k), k = 0..n
+} CumTable;
+
+/**
+ * Constrói a tabela em blocos de INTEGRAL_PAR_BLOCK painéis distribuídos entre
+ * 'nthreads' threads (0 = CPUs online). Cada bloco avalia de novo o nó da sua
+ * borda esquerda, então são 2n + nblocos avaliações de f, com
+ * nblocos = ceil(n / INTEGRAL_PAR_BLOCK) (2n+1 com um bloco só). A soma
+ * prefixada tem ordem fixa: a tabela é idêntica bit a bit para qualquer nthreads.
+ * 'f' deve ser segura para chamadas concorrentes.
+ * Erros: INT_ERR_NULL_FUNC, INT_ERR_N_INVALID (n = 0), INT_ERR_RANGE (a = b),
+ * INT_ERR_ALLOC. Retorna NULL em caso de erro.
+ */
+CumTable *cumtable_build(Func1D f, void *ctx, double a, double b, size_t n,
+                         unsigned nthreads, IntegralStatus *st);
+
+/**
+ * ∫_{x0}^{x1} f em O(1): F(x1) - F(x0), com F interpolada por Hermite cúbica
+ * no painel (exata nos nós). x0 > x1 dá o resultado com sinal trocado.
+ * Erros: INT_ERR_NULL_FUNC (tabela nula), INT_ERR_RANGE (x fora de [lo,hi]).
+ */
+double cumtable_query(const CumTable *T, double x0, double x1, IntegralStatus *st);
+
+void cumtable_free(CumTable **T);
+
+#ifdef __cplusplus
+}
+#endif
+#endif // INTEGRAL_CUM_H
@@ -0,0 +1,36 @@
+// inc/integral_de.h
+#ifndef INTEGRAL_DE_H
+#define INTEGRAL_DE_H
+
+#include "integral.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define DE_MAX_LEVEL 16 // passo mínimo h = 2^-16
+
+/**
+ * Quadratura dupla-exponencial (tanh-sinh) para integrandos com
+ * singularidades nas extremidades (ex.: 1/sqrt(x), log(x) em [0,1]).
+ * As extremidades podem ser infinitas:
+ *   [a,b] finito      -> tanh-sinh   x = c + hw*tanh(pi/2 sinh t)
+ *   [a,+inf), (-inf,b] -> exp-sinh   x = a + exp(pi/2 sinh t)
+ *   (-inf,+inf)        -> sinh-sinh  x = sinh(pi/2 sinh t)
+ * O nível k usa passo h = 2^-k em t; cada nível avalia só os nós novos
+ * (múltiplos ímpares de h) e reaproveita a soma anterior. f nunca é
+ * avaliada exatamente nas extremidades; nós onde f não é finita são descartados.
+ *
+ * Para quando |I_k - I_{k-1}| <= max(abs_tol, rel_tol*|I_k|) ou ao atingir
+ * max_level (<= DE_MAX_LEVEL). Saídas opcionais: *err_est e *n_evals.
+ * Status: INT_OK, INT_ERR_NOT_CONVERGED, INT_ERR_TOL_INVALID, INT_ERR_NULL_FUNC,
+ * INT_ERR_N_INVALID (max_level < 2 ou extremo NaN).
+ */
+double tanh_sinh_rule(Func1D f, void *ctx, double a, double b,
+                      double abs_tol, double rel_tol, int max_level,
+                      double *err_est, size_t *n_evals, IntegralStatus *st);
+
+#ifdef __cplusplus
+}
+#endif
+#endif // INTEGRAL_DE_H
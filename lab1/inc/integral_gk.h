@@ -0,0 +1,32 @@
+// inc/integral_gk.h
+#ifndef INTEGRAL_GK_H
+#define INTEGRAL_GK_H
+
+#include "integral.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Integração adaptativa Gauss-Kronrod G7-K15.
+ *
+ * Mantém uma fila de prioridade (heap) de subintervalos ordenada pelo erro
+ * estimado e bisseciona sempre o pior, até que
+ *     erro_total <= max(abs_tol, rel_tol * |resultado|)
+ * ou até esgotar 'max_evals' avaliações de f (cada subintervalo custa 15).
+ *
+ * Saídas opcionais: *err_est (erro absoluto estimado) e *n_evals (avaliações feitas).
+ * Status: INT_OK; INT_ERR_NOT_CONVERGED se o orçamento acabou antes da
+ * tolerância (o melhor resultado obtido é retornado); INT_ERR_TOL_INVALID se
+ * as duas tolerâncias forem <= 0; INT_ERR_N_INVALID se max_evals < 15;
+ * INT_ERR_NULL_FUNC; INT_ERR_ALLOC.
+ */
+double gauss_kronrod_adaptive(Func1D f, void *ctx, double a, double b,
+                              double abs_tol, double rel_tol, size_t max_evals,
+                              double *err_est, size_t *n_evals, IntegralStatus *st);
+
+#ifdef __cplusplus
+}
+#endif
+#endif // INTEGRAL_GK_H
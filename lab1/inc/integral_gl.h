@@ -0,0 +1,34 @@
+// inc/integral_gl.h
+#ifndef INTEGRAL_GL_H
+#define INTEGRAL_GL_H
+
+#include "integral.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define GL_MIN_ORDER 2
+#define GL_MAX_ORDER 64
+
+/**
+ * Gauss-Legendre composta: [a,b] dividido em n painéis iguais, cada um com
+ * 'order' nós (GL_MIN_ORDER..GL_MAX_ORDER). Custo: n*order avaliações; exata
+ * para polinômios de grau <= 2*order-1 em cada painel.
+ * Nós e pesos vêm de tabelas geradas em tempo de build (tools/gen_gl_tables.c).
+ * Erros: INT_ERR_N_INVALID (n = 0), INT_ERR_ORDER_INVALID, INT_ERR_NULL_FUNC.
+ */
+double gauss_legendre_rule(Func1D f, void *ctx, double a, double b, size_t n,
+                           unsigned order, IntegralStatus *st);
+
+/**
+ * Acesso às tabelas em [-1,1]: *x recebe os nós não negativos em ordem
+ * decrescente e *w os pesos correspondentes (para 'order' ímpar o último nó é 0).
+ * Retorna quantos nós foram apontados ((order+1)/2) ou 0 se a ordem for inválida.
+ */
+size_t gauss_legendre_table(unsigned order, const double **x, const double **w);
+
+#ifdef __cplusplus
+}
+#endif
+#endif // INTEGRAL_GL_H
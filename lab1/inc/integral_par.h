@@ -0,0 +1,33 @@
+// inc/integral_par.h
+#ifndef INTEGRAL_PAR_H
+#define INTEGRAL_PAR_H
+
+#include "integral.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Nós por bloco de trabalho. O particionamento depende só de n (nunca do
+// número de threads), o que garante o mesmo resultado para 1..N threads.
+#define INTEGRAL_PAR_BLOCK 8192u
+
+/*
+ * Versões multi-thread das regras compostas. [a,b] é dividido em blocos de
+ * INTEGRAL_PAR_BLOCK nós; cada bloco é somado com Kahan e as somas parciais
+ * são combinadas em árvore (pairwise) em ordem fixa: o resultado é idêntico
+ * bit a bit para qualquer 'nthreads' (0 = número de CPUs online).
+ *
+ * 'f' é chamada concorrentemente por várias threads: ela e o 'ctx' devem ser
+ * seguros para leitura simultânea. Os erros (n inválido, f nula) seguem as
+ * versões seriais; INT_ERR_ALLOC se o vetor de somas parciais não puder ser alocado.
+ */
+double trapezoidal_rule_par(Func1D f, void *ctx, double a, double b, size_t n,
+                            unsigned nthreads, IntegralStatus *st);
+double simpson_rule_par    (Func1D f, void *ctx, double a, double b, size_t n,
+                            unsigned nthreads, IntegralStatus *st); // n deve ser PAR
+
+#ifdef __cplusplus
+}
+#endif
+#endif // INTEGRAL_PAR_H
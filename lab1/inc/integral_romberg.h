@@ -0,0 +1,57 @@
+// inc/integral_romberg.h
+#ifndef INTEGRAL_ROMBERG_H
+#define INTEGRAL_ROMBERG_H
+
+#include "integral.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ROMBERG_MAX_LEVEL 30 // n máximo = 2^30 subintervalos
+
+/*
+ * Estado incremental de Romberg. O nível k corresponde ao trapézio com
+ * n = 2^k subintervalos; refinar k -> k+1 avalia só os 2^k pontos médios
+ * novos e reaproveita a soma dos nós já calculados. Sobre a sequência de
+ * trapézios roda a extrapolação de Richardson (tabela de Romberg), da qual
+ * guardamos apenas a última linha.
+ */
+typedef struct {
+    Func1D f;
+    void  *ctx;
+    double a, b;        // intervalo já ordenado (a <= b)
+    double sign;        // -1 se o chamador passou a > b
+    int    level;       // nível atual (-1 antes da primeira avaliação)
+    double node_sum;    // (f(a)+f(b))/2 + Σ f(nós interiores) do nível atual
+    double row[ROMBERG_MAX_LEVEL + 1]; // R[level][0..level]
+    double prev_best;   // R[level-1][level-1] (para a estimativa de erro)
+    size_t n_evals;     // avaliações de f feitas até agora
+} RombergState;
+
+/** Prepara o estado (não avalia f). Erros: INT_ERR_NULL_FUNC. */
+void   romberg_init(RombergState *R, Func1D f, void *ctx, double a, double b, IntegralStatus *st);
+
+/**
+ * Avança um nível (nível 0 avalia as duas extremidades) e retorna a melhor
+ * estimativa R[k][k]. INT_ERR_NOT_CONVERGED se ROMBERG_MAX_LEVEL já foi atingido.
+ */
+double romberg_refine(RombergState *R, IntegralStatus *st);
+
+/** Trapézio composto do nível atual (mesmos nós de trapezoidal_rule com n = 2^k). */
+double romberg_trapezoid(const RombergState *R);
+
+/**
+ * Refina até |R[k][k] - R[k-1][k-1]| <= max(abs_tol, rel_tol*|R[k][k]|) ou
+ * até o nível 'max_level' (limitado a ROMBERG_MAX_LEVEL). Pode ser chamada de
+ * novo com tolerância menor: continua do nível em que parou, pagando só pelos
+ * nós novos. *err_est (opcional) recebe a diferença acima.
+ * Status: INT_OK, INT_ERR_NOT_CONVERGED, INT_ERR_TOL_INVALID, INT_ERR_NULL_FUNC.
+ */
+double romberg_refine_until(RombergState *R, double abs_tol, double rel_tol, int max_level,
+                            double *err_est, IntegralStatus *st);
+
+#ifdef __cplusplus
+}
+#endif
+#endif // INTEGRAL_ROMBERG_H
@@ -0,0 +1,58 @@
+// inc/integral_samples.h
+#ifndef INTEGRAL_SAMPLES_H
+#define INTEGRAL_SAMPLES_H
+
+#include "integral.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Integração de dados amostrados (x_i, y_i), x estritamente crescente,
+// com espaçamento possivelmente não uniforme.
+typedef enum {
+    SAMPLE_TRAPEZOID = 0,
+    SAMPLE_SIMPSON          // Simpson não uniforme; intervalo final ímpar com correção de 3 pontos
+} SampleRule;
+
+/*
+ * Estado de integração em fluxo: as amostras chegam em pedaços de qualquer
+ * tamanho e só as últimas 3 ficam guardadas (memória constante). O resultado
+ * é o mesmo que o da chamada sobre o vetor inteiro.
+ */
+typedef struct {
+    SampleRule rule;
+    size_t n;            // amostras consumidas
+    double sum, comp;    // soma (Kahan) dos intervalos/pares já fechados
+    double x[3], y[3];   // [0] anterior ao par aberto, [1] início do par, [2] meio pendente
+    int    open;         // Simpson: 1 se x[2]/y[2] aguarda o fim do par
+    IntegralStatus status;
+} SampleStream;
+
+void   sample_stream_init  (SampleStream *s, SampleRule rule);
+void   sample_stream_push  (SampleStream *s, const double *x, const double *y, size_t n);
+/** Integral das amostras já consumidas. INT_ERR_N_INVALID com menos de 2 amostras. */
+double sample_stream_result(const SampleStream *s, IntegralStatus *st);
+
+// Vetores completos (mesma implementação do fluxo)
+double trapezoid_samples(const double *x, const double *y, size_t n, IntegralStatus *st);
+double simpson_samples  (const double *x, const double *y, size_t n, IntegralStatus *st);
+
+/**
+ * Integra a coluna col_y em função da coluna col_x (colunas a partir de 0,
+ * separadas por TAB, vírgula, ';' ou espaço) de um arquivo texto como
+ * out/sim_out.tsv (lab2) ou out/traj.csv (lab3). col_x < 0 usa o índice da
+ * amostra como x. Linhas não numéricas (cabeçalho) são ignoradas.
+ * O arquivo é mapeado com mmap e lido sequencialmente (páginas já lidas são
+ * devolvidas ao kernel); se mmap não for possível, é lido em blocos de 1 MiB.
+ * A memória usada não depende do tamanho do arquivo.
+ * *n_samples (opcional) recebe o nº de amostras integradas.
+ * Erros: INT_ERR_IO, INT_ERR_DATA, INT_ERR_N_INVALID (< 2 amostras).
+ */
+double integrate_sample_file(const char *path, int col_x, int col_y, SampleRule rule,
+                             size_t *n_samples, IntegralStatus *st);
+
+#ifdef __cplusplus
+}
+#endif
+#endif // INTEGRAL_SAMPLES_H
@@ -0,0 +1,37 @@
+// inc/integral_sweep.h
+#ifndef INTEGRAL_SWEEP_H
+#define INTEGRAL_SWEEP_H
+
+#include "integral.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Resultados de todas as regras compostas sobre os mesmos f, [a,b] e n.
+typedef struct {
+    double left;            // riemann_left
+    double right;           // riemann_right
+    double midpoint;        // riemann_midpoint / midpoint_rule
+    double trapezoidal;     // trapezoidal_rule
+    double simpson;         // simpson_rule (NAN se n for ímpar)
+    double simpson_2n;      // (T + 2M)/3 = Simpson na malha nós + pontos médios (2n subintervalos)
+    double err_trapezoidal; // Richardson: I - T ~ (2/3)(M - T)
+    double err_midpoint;    // Richardson: I - M ~ (T - M)/3
+    size_t n_evals;         // avaliações de f: 2n + 1
+} IntegralAllRules;
+
+/**
+ * Uma única varredura pelos n+1 nós e n pontos médios calcula todas as
+ * regras de integral.h (2n+1 avaliações em vez de até 5n). Os valores são
+ * iguais aos das funções separadas a menos de arredondamento.
+ * n ímpar é aceito: só 'simpson' fica NAN. Erros: INT_ERR_N_INVALID (n = 0),
+ * INT_ERR_NULL_FUNC (f ou out nulos).
+ */
+void integral_all_rules(Func1D f, void *ctx, double a, double b, size_t n,
+                        IntegralAllRules *out, IntegralStatus *st);
+
+#ifdef __cplusplus
+}
+#endif
+#endif // INTEGRAL_SWEEP_H
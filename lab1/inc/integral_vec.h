@@ -0,0 +1,40 @@
+// inc/integral_vec.h
+#ifndef INTEGRAL_VEC_H
+#define INTEGRAL_VEC_H
+
+#include "integral.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Integrando vetorial: preenche out[0..m-1] com as m componentes em x.
+// Subexpressões comuns (ex.: exp(-x^2) em todos os momentos) são calculadas
+// uma vez por nó dentro do callback.
+typedef void (*FuncVec)(double x, double *out, size_t m, void *ctx);
+
+/*
+ * Versões vetoriais das regras compostas: integra as m componentes com uma
+ * chamada de f por nó (mesmo custo em avaliações da regra escalar) e grava
+ * out[j] = ∫ f_j. As m somas ficam contíguas em 'out' e são acumuladas com
+ * laços simples sobre j (vetorizáveis pelo compilador).
+ *
+ * Validação igual às escalares; além disso INT_ERR_DIM_INVALID (m = 0),
+ * INT_ERR_NULL_FUNC (out nulo) e INT_ERR_ALLOC (buffer de m valores).
+ * Em erro, out[] recebe NAN (se não for nulo).
+ */
+void midpoint_rule_vec   (FuncVec f, void *ctx, double a, double b, size_t n,
+                          size_t m, double *out, IntegralStatus *st);
+void trapezoidal_rule_vec(FuncVec f, void *ctx, double a, double b, size_t n,
+                          size_t m, double *out, IntegralStatus *st);
+void simpson_rule_vec    (FuncVec f, void *ctx, double a, double b, size_t n,
+                          size_t m, double *out, IntegralStatus *st); // n deve ser PAR
+
+// Gauss-Legendre composta (n painéis de 'order' nós, ver integral_gl.h).
+void gauss_legendre_vec  (FuncVec f, void *ctx, double a, double b, size_t n,
+                          unsigned order, size_t m, double *out, IntegralStatus *st);
+
+#ifdef __cplusplus
+}
+#endif
+#endif // INTEGRAL_VEC_H
@@ -0,0 +1,50 @@
+// inc/parallel.h
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include <stddef.h> // size_t
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Trabalho de um bloco: processa o bloco 'blk' (0 <= blk < nblocks).
+typedef void (*ParBlockFn)(size_t blk, void *arg);
+
+// Como ParBlockFn, com o índice da thread que executa (0 <= worker < par_threads).
+typedef void (*ParWorkerFn)(size_t blk, unsigned worker, void *arg);
+
+// Número de threads usado quando o chamador passa nthreads = 0 (CPUs online).
+unsigned par_default_threads(void);
+
+// Threads que par_for/par_for_worker usam para 'nblocks' blocos (>= 1).
+unsigned par_threads(size_t nblocks, unsigned nthreads);
+
+/**
+ * Executa fn(blk, arg) para blk = 0..nblocks-1 distribuindo os blocos entre
+ * 'nthreads' threads (0 = par_default_threads()). A thread chamadora também
+ * trabalha; se pthread_create falhar, os blocos restantes são feitos por ela.
+ *
+ * A ordem de execução dos blocos NÃO é definida: cada bloco deve escrever
+ * somente na sua própria posição de saída para que o resultado não dependa
+ * do número de threads.
+ */
+void par_for(size_t nblocks, unsigned nthreads, ParBlockFn fn, void *arg);
+
+/**
+ * Igual a par_for, mas passa a fn o índice da thread: o chamador pode alocar
+ * antes um rascunho por thread (par_threads(nblocks, nthreads) deles) em vez
+ * de um por bloco.
+ */
+void par_for_worker(size_t nblocks, unsigned nthreads, ParWorkerFn fn, void *arg);
+
+/**
+ * Soma em árvore (pairwise) com divisão fixa em n/2: a ordem das somas depende
+ * só de n, então o resultado é idêntico bit a bit para a mesma entrada.
+ */
+double par_pairwise_sum(const double *v, size_t n);
+
+#ifdef __cplusplus
+}
+#endif
+#endif // PARALLEL_H
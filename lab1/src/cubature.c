@@ -0,0 +1,350 @@
+// src/cubature.c
+#include "cubature.h"
+#include "integral_gl.h"
+#include "parallel.h"
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#define CUB_BLOCK 1024u       // pontos por bloco de trabalho
+#define QMC_FIRST_ROUND 1024u // pontos por réplica na primeira rodada
+#define SOBOL_BITS 32
+
+// Soma compensada (Kahan) de w[i]*v[i] ou, se w == NULL, de v[i]
+static double _kahan_dot(const double *w, const double *v, size_t n) {
+    double sum = 0.0, c = 0.0;
+    for (size_t i = 0; i < n; ++i) {
+        double y = (w ? w[i] * v[i] : v[i]) - c;
+        double t = sum + y;
+        c = (t - sum) - y;
+        sum = t;
+    }
+    return sum;
+}
+
+// ======================= Produto tensorial de Gauss =======================
+
+typedef struct {
+    FuncND   f;
+    void    *ctx;
+    unsigned dim;
+    size_t   m;         // nós 1-D por eixo (order * panels)
+    size_t   total;     // m^dim
+    const double *nx;   // nx[d*m + i]: nó i do eixo d
+    const double *nw;   // nw[d*m + i]: peso (já escalado) do nó i do eixo d
+    double  *partial;   // uma soma por bloco
+    double  *scratch;   // CUB_BLOCK * (dim + 2) doubles por thread
+} GaussJob;
+
+static void _gauss_block(size_t blk, unsigned worker, void *p) {
+    GaussJob *J = (GaussJob *)p;
+    size_t lo = blk * CUB_BLOCK;
+    size_t cnt = J->total - lo < CUB_BLOCK ? J->total - lo : CUB_BLOCK;
+    unsigned dim = J->dim;
+    if (cnt == 0 || dim == 0) { J->partial[blk] = 0.0; return; }
+
+    double *x = J->scratch + (size_t)worker * CUB_BLOCK * (dim + 2);
+    double *w = x + cnt * dim;
+    double *y = w + cnt;
+
+    // Índice linear -> dígitos na base m (odômetro), um dígito por eixo
+    size_t digit[CUBATURE_MAX_DIM];
+    size_t rem = lo;
+    for (unsigned d = 0; d < dim; ++d) { digit[d] = rem % J->m; rem /= J->m; }
+
+    for (size_t i = 0; i < cnt; ++i) {
+        double wt = 1.0;
+        for (unsigned d = 0; d < dim; ++d) {
+            x[i * dim + d] = J->nx[d * J->m + digit[d]];
+            wt *= J->nw[d * J->m + digit[d]];
+        }
+        w[i] = wt;
+        for (unsigned d = 0; d < dim; ++d) {
+            if (++digit[d] < J->m) break;
+            digit[d] = 0;
+        }
+    }
+
+    J->f(x, cnt, dim, y, J->ctx);
+    J->partial[blk] = _kahan_dot(w, y, cnt);
+}
+
+static double _gauss_tensor(FuncND f, void *ctx, unsigned dim, const double *lo, const double *hi,
+                            unsigned order, size_t panels, unsigned nthreads,
+                            size_t *evals, IntegralStatus *st) {
+    const double *gx, *gw;
+    size_t half = gauss_legendre_table(order, &gx, &gw);
+    if (half == 0) { *st = INT_ERR_ORDER_INVALID; return NAN; }
+
+    size_t m = (size_t)order * panels;
+    size_t total = 1;
+    for (unsigned d = 0; d < dim; ++d) {
+        if (total > SIZE_MAX / m) { *st = INT_ERR_N_INVALID; return NAN; }
+        total *= m;
+    }
+
+    // Nós/pesos 1-D de cada eixo (regra composta com 'panels' painéis)
+    double *nx = (double *)malloc(2 * (size_t)dim * m * sizeof(double));
+    size_t nblocks = (total + CUB_BLOCK - 1) / CUB_BLOCK;
+    unsigned nw_threads = par_threads(nblocks, nthreads);
+    double *partial = (double *)malloc(nblocks * sizeof(double));
+    double *scratch = (double *)malloc((size_t)nw_threads * CUB_BLOCK * (dim + 2) * sizeof(double));
+    if (!nx || !partial || !scratch) {
+        free(nx); free(partial); free(scratch);
+        *st = INT_ERR_ALLOC;
+        return NAN;
+    }
+    double *nw = nx + (size_t)dim * m;
+
+    for (unsigned d = 0; d < dim; ++d) {
+        double h = (hi[d] - lo[d]) / (double)panels; // com sinal: hi < lo inverte
+        double hw = 0.5 * h;
+        size_t k = 0;
+        for (size_t p = 0; p < panels; ++p) {
+            double c = lo[d] + ((double)p + 0.5) * h;
+            for (size_t i = 0; i < half; ++i) {
+                nx[d * m + k] = c - hw * gx[i]; nw[d * m + k] = hw * gw[i]; k++;
+                if (gx[i] != 0.0) { nx[d * m + k] = c + hw * gx[i]; nw[d * m + k] = hw * gw[i]; k++; }
+            }
+        }
+    }
+
+    GaussJob J = { .f = f, .ctx = ctx, .dim = dim, .m = m, .total = total,
+                   .nx = nx, .nw = nw, .partial = partial, .scratch = scratch };
+    par_for_worker(nblocks, nw_threads, _gauss_block, &J);
+
+    double res = par_pairwise_sum(partial, nblocks);
+    free(scratch);
+    free(partial);
+    free(nx);
+
+    *evals += total;
+    *st = INT_OK;
+    return res;
+}
+
+double cubature_gauss(FuncND f, void *ctx, unsigned dim, const double *lo, const double *hi,
+                      unsigned order, size_t panels, unsigned nthreads,
+                      double *err_est, size_t *n_evals, IntegralStatus *st) {
+    if (n_evals) *n_evals = 0;
+    if (err_est) *err_est = 0.0;
+    if (!f) { if (st) *st = INT_ERR_NULL_FUNC; return NAN; }
+    if (dim == 0 || dim > CUBATURE_MAX_DIM || !lo || !hi) { if (st) *st = INT_ERR_DIM_INVALID; return NAN; }
+    if (order < GL_MIN_ORDER || order > GL_MAX_ORDER) { if (st) *st = INT_ERR_ORDER_INVALID; return NAN; }
+    if (panels == 0) { if (st) *st = INT_ERR_N_INVALID; return NAN; }
+    for (unsigned d = 0; d < dim; ++d) {
+        if (lo[d] == hi[d]) { if (st) *st = INT_OK; return 0.0; }
+    }
+
+    IntegralStatus s;
+    size_t evals = 0;
+    double res = _gauss_tensor(f, ctx, dim, lo, hi, order, panels, nthreads, &evals, &s);
+    if (s == INT_OK && err_est) {
+        unsigned o2 = (order > GL_MIN_ORDER) ? order - 1 : order + 1;
+        double res2 = _gauss_tensor(f, ctx, dim, lo, hi, o2, panels, nthreads, &evals, &s);
+        if (s == INT_OK) *err_est = fabs(res - res2);
+    }
+    if (n_evals) *n_evals = evals;
+    if (st) *st = s;
+    return (s == INT_OK) ? res : NAN;
+}
+
+// ========================= Quasi-Monte Carlo (Sobol) =========================
+
+// Direções de Sobol (Joe & Kuo, new-joe-kuo-6.21201) para as dimensões 2..21:
+// grau s do polinômio primitivo, coeficientes a e números iniciais m_1..m_s.
+typedef struct { unsigned s, a; unsigned m[8]; } SobolPoly;
+
+static const SobolPoly sobol_polys[CUBATURE_MAX_DIM - 1] = {
+    {1,  0, {1}},
+    {2,  1, {1, 3}},
+    {3,  1, {1, 3, 1}},
+    {3,  2, {1, 1, 1}},
+    {4,  1, {1, 1, 3, 3}},
+    {4,  4, {1, 3, 5, 13}},
+    {5,  2, {1, 1, 5, 5, 17}},
+    {5,  4, {1, 1, 5, 5, 5}},
+    {5,  7, {1, 1, 7, 11, 19}},
+    {5, 11, {1, 1, 5, 1, 1}},
+    {5, 13, {1, 1, 1, 3, 11}},
+    {5, 14, {1, 3, 5, 5, 31}},
+    {6,  1, {1, 3, 3, 9, 7, 49}},
+    {6, 13, {1, 1, 1, 15, 21, 21}},
+    {6, 16, {1, 3, 1, 13, 27, 49}},
+    {6, 19, {1, 1, 1, 15, 7, 5}},
+    {6, 22, {1, 3, 1, 15, 13, 25}},
+    {6, 25, {1, 1, 5, 5, 19, 61}},
+    {7,  1, {1, 3, 7, 11, 23, 15, 103}},
+    {7,  4, {1, 3, 7, 13, 13, 15, 69}},
+};
+
+static void _sobol_directions(unsigned dim, uint32_t V[][SOBOL_BITS]) {
+    // Dimensão 1: van der Corput
+    for (unsigned j = 0; j < SOBOL_BITS; ++j) V[0][j] = (uint32_t)1u << (31 - j);
+
+    for (unsigned d = 1; d < dim; ++d) {
+        const SobolPoly *P = &sobol_polys[d - 1];
+        unsigned s = P->s;
+        for (unsigned j = 0; j < s; ++j) V[d][j] = (uint32_t)P->m[j] << (31 - j);
+        for (unsigned j = s; j < SOBOL_BITS; ++j) {
+            uint32_t v = V[d][j - s] ^ (V[d][j - s] >> s);
+            for (unsigned k = 1; k < s; ++k)
+                if ((P->a >> (s - 1 - k)) & 1u) v ^= V[d][j - k];
+            V[d][j] = v;
+        }
+    }
+}
+
+// splitmix64: gera os deslocamentos digitais a partir de semente fixa
+static uint64_t _splitmix64(uint64_t *state) {
+    uint64_t z = (*state += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+typedef struct {
+    FuncND   f;
+    void    *ctx;
+    unsigned dim;
+    const double *lo, *hi;
+    uint32_t (*V)[SOBOL_BITS];
+    uint32_t shift[CUBATURE_QMC_REPLICAS][CUBATURE_MAX_DIM];
+    size_t   first;        // primeiro índice (ordem de Gray) da rodada
+    size_t   count;        // pontos por réplica na rodada
+    size_t   blocks_per_rep;
+    double  *partial;      // [rep * blocks_per_rep + blk]
+    double  *scratch;      // CUB_BLOCK * (dim + 1) doubles por thread
+} QmcJob;
+
+static void _qmc_block(size_t job_blk, unsigned worker, void *p) {
+    QmcJob *J = (QmcJob *)p;
+    size_t rep = job_blk / J->blocks_per_rep;
+    size_t blk = job_blk % J->blocks_per_rep;
+    size_t i0 = J->first + blk * CUB_BLOCK;
+    size_t cnt = J->count - blk * CUB_BLOCK;
+    if (cnt > CUB_BLOCK) cnt = CUB_BLOCK;
+    unsigned dim = J->dim;
+    if (cnt == 0 || dim == 0) { J->partial[job_blk] = 0.0; return; }
+
+    double *x = J->scratch + (size_t)worker * CUB_BLOCK * (dim + 1);
+    double *y = x + cnt * dim;
+
+    // Ponto de índice i0 na ordem de Gray: XOR das direções dos bits de g(i0)
+    uint32_t q[CUBATURE_MAX_DIM];
+    size_t g = i0 ^ (i0 >> 1);
+    for (unsigned d = 0; d < dim; ++d) {
+        uint32_t v = 0;
+        for (unsigned j = 0; j < SOBOL_BITS; ++j)
+            if ((g >> j) & 1u) v ^= J->V[d][j];
+        q[d] = v;
+    }
+
+    const double inv = 1.0 / 4294967296.0; // 2^-32
+    for (size_t i = 0; i < cnt; ++i) {
+        for (unsigned d = 0; d < dim; ++d) {
+            double u = ((double)(q[d] ^ J->shift[rep][d]) + 0.5) * inv;
+            x[i * dim + d] = J->lo[d] + (J->hi[d] - J->lo[d]) * u;
+        }
+        // Próximo ponto: troca um único bit (o menos significativo de i+1)
+        size_t nxt = i0 + i + 1;
+        unsigned c = 0;
+        while (((nxt >> c) & 1u) == 0) c++;
+        for (unsigned d = 0; d < dim; ++d) q[d] ^= J->V[d][c];
+    }
+
+    J->f(x, cnt, dim, y, J->ctx);
+    J->partial[job_blk] = _kahan_dot(NULL, y, cnt);
+}
+
+double cubature_qmc(FuncND f, void *ctx, unsigned dim, const double *lo, const double *hi,
+                    size_t max_evals, double abs_tol, double rel_tol, unsigned nthreads,
+                    CubatureReport report, void *user,
+                    double *err_est, size_t *n_evals, IntegralStatus *st) {
+    const size_t R = CUBATURE_QMC_REPLICAS;
+    if (n_evals) *n_evals = 0;
+    if (err_est) *err_est = 0.0;
+    if (!f) { if (st) *st = INT_ERR_NULL_FUNC; return NAN; }
+    if (dim == 0 || dim > CUBATURE_MAX_DIM || !lo || !hi) { if (st) *st = INT_ERR_DIM_INVALID; return NAN; }
+    if (abs_tol < 0.0 || rel_tol < 0.0 || (abs_tol <= 0.0 && rel_tol <= 0.0)) {
+        if (st) *st = INT_ERR_TOL_INVALID;
+        return NAN;
+    }
+    if (max_evals < R * QMC_FIRST_ROUND) { if (st) *st = INT_ERR_N_INVALID; return NAN; }
+
+    double vol = 1.0;
+    for (unsigned d = 0; d < dim; ++d) vol *= hi[d] - lo[d];
+    if (vol == 0.0) { if (st) *st = INT_OK; return 0.0; }
+
+    // Limite de pontos por réplica: orçamento e 2^32 índices de Sobol
+    size_t per_rep_max = max_evals / R;
+    if (per_rep_max > ((size_t)1 << 31)) per_rep_max = (size_t)1 << 31;
+
+    QmcJob *J = (QmcJob *)calloc(1, sizeof(QmcJob));
+    uint32_t (*V)[SOBOL_BITS] = malloc(sizeof(uint32_t[CUBATURE_MAX_DIM][SOBOL_BITS]));
+    size_t max_blocks = R * (per_rep_max / CUB_BLOCK + 1);
+    unsigned nw_threads = par_threads(max_blocks, nthreads);
+    double *partial = (double *)malloc(max_blocks * sizeof(double));
+    double *scratch = (double *)malloc((size_t)nw_threads * CUB_BLOCK * (dim + 1) * sizeof(double));
+    if (!J || !V || !partial || !scratch) {
+        free(J); free(V); free(partial); free(scratch);
+        if (st) *st = INT_ERR_ALLOC;
+        return NAN;
+    }
+    _sobol_directions(dim, V);
+
+    uint64_t seed = 0x5EEDC0DEull;
+    for (size_t r = 0; r < R; ++r)
+        for (unsigned d = 0; d < dim; ++d)
+            J->shift[r][d] = (uint32_t)(_splitmix64(&seed) >> 32);
+
+    J->f = f; J->ctx = ctx; J->dim = dim; J->lo = lo; J->hi = hi; J->V = V;
+    J->partial = partial;
+    J->scratch = scratch;
+
+    double rep_sum[CUBATURE_QMC_REPLICAS] = {0};
+    size_t n_per_rep = 0;
+    double est = NAN, err = INFINITY;
+    IntegralStatus status = INT_OK;
+
+    for (;;) {
+        // Rodada: dobra o nº de pontos (1024, 1024, 2048, 4096, ...)
+        size_t count = (n_per_rep == 0) ? QMC_FIRST_ROUND : n_per_rep;
+        if (n_per_rep + count > per_rep_max) { status = INT_ERR_NOT_CONVERGED; break; }
+
+        J->first = n_per_rep;
+        J->count = count;
+        J->blocks_per_rep = (count + CUB_BLOCK - 1) / CUB_BLOCK;
+        par_for_worker(R * J->blocks_per_rep, nw_threads, _qmc_block, J);
+
+        for (size_t r = 0; r < R; ++r)
+            rep_sum[r] += par_pairwise_sum(partial + r * J->blocks_per_rep, J->blocks_per_rep);
+        n_per_rep += count;
+
+        // Média e erro padrão entre réplicas
+        double mean = 0.0;
+        for (size_t r = 0; r < R; ++r) mean += rep_sum[r] / (double)n_per_rep;
+        mean /= (double)R;
+        double var = 0.0;
+        for (size_t r = 0; r < R; ++r) {
+            double e = rep_sum[r] / (double)n_per_rep - mean;
+            var += e * e;
+        }
+        var /= (double)(R - 1);
+        est = vol * mean;
+        err = fabs(vol) * sqrt(var / (double)R);
+
+        if (report) report(n_per_rep * R, est, err, user);
+        if (err <= fmax(abs_tol, rel_tol * fabs(est))) break;
+    }
+
+    free(scratch);
+    free(partial);
+    free(V);
+    free(J);
+
+    if (n_evals) *n_evals = n_per_rep * R;
+    if (err_est) *err_est = err;
+    if (st) *st = status;
+    return (status == INT_ERR_ALLOC) ? NAN : est;
+}
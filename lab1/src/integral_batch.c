@@ -0,0 +1,157 @@
+// src/integral_batch.c
+#include "integral_batch.h"
+#include <math.h>
+#include <stdlib.h>
+
+#define BATCH_CHUNK 256 // intervalos por fatia no caminho SoA (cabe em cache)
+
+typedef enum { BATCH_TRAP, BATCH_SIMPSON } BatchRule;
+
+static inline double _weight(BatchRule rule, size_t k, size_t n) {
+    if (k == 0 || k == n) return (rule == BATCH_TRAP) ? 0.5 : 1.0;
+    if (rule == BATCH_TRAP) return 1.0;
+    return (k % 2 != 0) ? 4.0 : 2.0;
+}
+
+static void _fill(double *out, IntegralStatus *st_out, size_t m, double v, IntegralStatus s) {
+    for (size_t i = 0; i < m; ++i) {
+        out[i] = v;
+        if (st_out) st_out[i] = s;
+    }
+}
+
+/*
+ * Caminho de grade compartilhada: todos os intervalos não nulos têm o mesmo
+ * h e começam em lo_min + s_i*h com s_i inteiro. Retorna 0 se a condição não
+ * vale (ou não compensa) e o chamador cai no caminho geral.
+ */
+static int _batch_shared_grid(BatchRule rule, Func1D f, void *ctx, size_t m, size_t n,
+                              const double *lo, const double *hi, const double *sign,
+                              double *out) {
+    double h = 0.0, lo_min = INFINITY, hi_max = -INFINITY;
+    size_t active = 0;
+    for (size_t i = 0; i < m; ++i) {
+        if (lo[i] == hi[i]) continue;
+        double hi_i = (hi[i] - lo[i]) / (double)n;
+        if (active == 0) h = hi_i;
+        else if (fabs(hi_i - h) > 1e-12 * h) return 0;
+        if (lo[i] < lo_min) lo_min = lo[i];
+        if (hi[i] > hi_max) hi_max = hi[i];
+        active++;
+    }
+    if (active < 2) return 0;
+
+    double span = (hi_max - lo_min) / h;
+    if (!(span < (double)(active * (n + 1)))) return 0; // grade não economiza nada
+    size_t G = (size_t)llround(span) + 1;
+
+    size_t *start = (size_t *)malloc(m * sizeof(size_t));
+    if (!start) return 0;
+    for (size_t i = 0; i < m; ++i) {
+        if (lo[i] == hi[i]) { start[i] = 0; continue; }
+        double off = (lo[i] - lo_min) / h;
+        double r = nearbyint(off);
+        if (fabs(off - r) > 1e-9 * fmax(1.0, r) || (size_t)r + n >= G) { free(start); return 0; }
+        start[i] = (size_t)r;
+    }
+
+    double *y = (double *)malloc(G * sizeof(double));
+    if (!y) { free(start); return 0; }
+    for (size_t k = 0; k < G; ++k) y[k] = f(lo_min + (double)k * h, ctx);
+
+    for (size_t i = 0; i < m; ++i) {
+        if (lo[i] == hi[i]) { out[i] = 0.0; continue; }
+        const double *w = y + start[i];
+        double s;
+        if (rule == BATCH_TRAP) {
+            s = 0.5 * (w[0] + w[n]);
+            for (size_t k = 1; k < n; ++k) s += w[k];
+            s *= h;
+        } else {
+            double s4 = 0.0, s2 = 0.0;
+            for (size_t k = 1; k < n; k += 2) s4 += w[k];
+            for (size_t k = 2; k < n; k += 2) s2 += w[k];
+            s = (h / 3.0) * (w[0] + w[n] + 4.0 * s4 + 2.0 * s2);
+        }
+        out[i] = sign[i] * s;
+    }
+    free(y);
+    free(start);
+    return 1;
+}
+
+// Caminho geral: nós de vários intervalos por vez, acumuladores em SoA.
+static void _batch_soa(BatchRule rule, Func1D f, void *ctx, void *const *ctxs, size_t m, size_t n,
+                       const double *lo, const double *hi, const double *sign, double *out) {
+    double h[BATCH_CHUNK], acc[BATCH_CHUNK], x[BATCH_CHUNK], y[BATCH_CHUNK];
+
+    for (size_t i0 = 0; i0 < m; i0 += BATCH_CHUNK) {
+        size_t c = (m - i0 < BATCH_CHUNK) ? m - i0 : BATCH_CHUNK;
+        for (size_t i = 0; i < c; ++i) {
+            h[i] = (hi[i0 + i] - lo[i0 + i]) / (double)n;
+            acc[i] = 0.0;
+        }
+        for (size_t k = 0; k <= n; ++k) {
+            const double wk = _weight(rule, k, n);
+            for (size_t i = 0; i < c; ++i)
+                x[i] = (k == n) ? hi[i0 + i] : lo[i0 + i] + (double)k * h[i];
+            for (size_t i = 0; i < c; ++i)
+                y[i] = (lo[i0 + i] == hi[i0 + i]) ? 0.0 : f(x[i], ctxs ? ctxs[i0 + i] : ctx);
+            for (size_t i = 0; i < c; ++i)
+                acc[i] += wk * y[i];
+        }
+        const double scale = (rule == BATCH_TRAP) ? 1.0 : 1.0 / 3.0;
+        for (size_t i = 0; i < c; ++i)
+            out[i0 + i] = sign[i0 + i] * scale * h[i] * acc[i];
+    }
+}
+
+static void _batch(BatchRule rule, Func1D f, void *ctx, void *const *ctxs,
+                   const double *a, const double *b, size_t m, size_t n,
+                   double *out, IntegralStatus *st_out, IntegralStatus *st) {
+    IntegralStatus s = INT_OK;
+    if (!f) s = INT_ERR_NULL_FUNC;
+    else if (n == 0 || (rule == BATCH_SIMPSON && n % 2 != 0)) s = INT_ERR_N_INVALID;
+    else if (m > 0 && (!a || !b || !out)) s = INT_ERR_N_INVALID;
+    if (s != INT_OK || m == 0) {
+        if (out) _fill(out, st_out, m, NAN, s);
+        if (st) *st = s;
+        return;
+    }
+
+    // Ordena cada intervalo uma vez (lo <= hi) e guarda o sinal
+    double *lo = (double *)malloc(3 * m * sizeof(double));
+    if (!lo) {
+        _fill(out, st_out, m, NAN, INT_ERR_ALLOC);
+        if (st) *st = INT_ERR_ALLOC;
+        return;
+    }
+    double *hi = lo + m, *sign = hi + m;
+    for (size_t i = 0; i < m; ++i) {
+        int swap = b[i] < a[i];
+        lo[i] = swap ? b[i] : a[i];
+        hi[i] = swap ? a[i] : b[i];
+        sign[i] = swap ? -1.0 : 1.0;
+    }
+
+    if (ctxs || !_batch_shared_grid(rule, f, ctx, m, n, lo, hi, sign, out))
+        _batch_soa(rule, f, ctx, ctxs, m, n, lo, hi, sign, out);
+
+    free(lo);
+    if (st_out) for (size_t i = 0; i < m; ++i) st_out[i] = INT_OK;
+    if (st) *st = INT_OK;
+}
+
+// --- Simpson (composta) em lote ---
+void simpson_rule_batch(Func1D f, void *ctx, void *const *ctxs,
+                        const double *a, const double *b, size_t m, size_t n,
+                        double *out, IntegralStatus *st_out, IntegralStatus *st) {
+    _batch(BATCH_SIMPSON, f, ctx, ctxs, a, b, m, n, out, st_out, st);
+}
+
+// --- Trapézio (composta) em lote ---
+void trapezoidal_rule_batch(Func1D f, void *ctx, void *const *ctxs,
+                            const double *a, const double *b, size_t m, size_t n,
+                            double *out, IntegralStatus *st_out, IntegralStatus *st) {
+    _batch(BATCH_TRAP, f, ctx, ctxs, a, b, m, n, out, st_out, st);
+}
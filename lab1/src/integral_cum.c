@@ -0,0 +1,137 @@
+// src/integral_cum.c
+#include "integral_cum.h"
+#include "integral_par.h"
+#include "parallel.h"
+#include <math.h>
+#include <stdlib.h>
+
+typedef struct {
+    Func1D    f;
+    void     *ctx;
+    CumTable *T;
+    double   *total;   // soma dos painéis de cada bloco
+    double   *offset;  // F no início de cada bloco (2ª passada)
+} CumArgs;
+
+static inline double _node(const CumTable *T, size_t k) {
+    return (k == T->n) ? T->hi : T->lo + k * T->h;
+}
+
+// 1ª passada: avalia f nos nós/pontos médios do bloco e faz a soma prefixada local.
+static void _panels_block(size_t blk, void *p) {
+    CumArgs *A = (CumArgs *)p;
+    CumTable *T = A->T;
+    size_t lo = blk * INTEGRAL_PAR_BLOCK;
+    size_t hi = lo + INTEGRAL_PAR_BLOCK;
+    if (hi > T->n) hi = T->n;
+
+    double f_left = A->f(_node(T, lo), A->ctx);
+    double sum = 0.0, c = 0.0;
+    for (size_t k = lo; k < hi; ++k) {
+        double f_mid   = A->f(T->lo + (k + 0.5) * T->h, A->ctx);
+        double f_right = A->f(_node(T, k + 1), A->ctx);
+        T->fx[k] = f_left;
+
+        // Simpson no painel [x_k, x_{k+1}], somado com Kahan
+        double y = (T->h / 6.0) * (f_left + 4.0 * f_mid + f_right) - c;
+        double t = sum + y;
+        c = (t - sum) - y;
+        sum = t;
+        T->F[k + 1] = sum;
+        f_left = f_right;
+    }
+    if (hi == T->n) T->fx[T->n] = f_left;
+    A->total[blk] = sum;
+}
+
+// 2ª passada: soma o deslocamento global do bloco.
+static void _offset_block(size_t blk, void *p) {
+    CumArgs *A = (CumArgs *)p;
+    CumTable *T = A->T;
+    size_t lo = blk * INTEGRAL_PAR_BLOCK;
+    size_t hi = lo + INTEGRAL_PAR_BLOCK;
+    if (hi > T->n) hi = T->n;
+    double off = A->offset[blk];
+    for (size_t k = lo + 1; k <= hi; ++k) T->F[k] += off;
+}
+
+CumTable *cumtable_build(Func1D f, void *ctx, double a, double b, size_t n,
+                         unsigned nthreads, IntegralStatus *st) {
+    if (!f) { if (st) *st = INT_ERR_NULL_FUNC; return NULL; }
+    if (n == 0) { if (st) *st = INT_ERR_N_INVALID; return NULL; }
+    if (a == b) { if (st) *st = INT_ERR_RANGE; return NULL; }
+    if (b < a) { double tmp = a; a = b; b = tmp; }
+
+    size_t nblocks = (n + INTEGRAL_PAR_BLOCK - 1) / INTEGRAL_PAR_BLOCK;
+    CumTable *T = (CumTable *)malloc(sizeof(CumTable));
+    double *total = (double *)malloc(2 * nblocks * sizeof(double));
+    if (T) {
+        T->F  = (double *)malloc((n + 1) * sizeof(double));
+        T->fx = (double *)malloc((n + 1) * sizeof(double));
+    }
+    if (!T || !total || !T->F || !T->fx) {
+        if (T) { free(T->F); free(T->fx); free(T); }
+        free(total);
+        if (st) *st = INT_ERR_ALLOC;
+        return NULL;
+    }
+    T->lo = a;
+    T->hi = b;
+    T->n  = n;
+    T->h  = (b - a) / (double)n;
+    T->F[0] = 0.0;
+
+    CumArgs args = { .f = f, .ctx = ctx, .T = T, .total = total, .offset = total + nblocks };
+    par_for(nblocks, nthreads, _panels_block, &args);
+
+    // Prefixo dos totais dos blocos (serial, ordem fixa, Kahan)
+    double run = 0.0, c = 0.0;
+    for (size_t i = 0; i < nblocks; ++i) {
+        args.offset[i] = run;
+        double y = total[i] - c;
+        double t = run + y;
+        c = (t - run) - y;
+        run = t;
+    }
+    if (nblocks > 1) par_for(nblocks, nthreads, _offset_block, &args);
+
+    free(total);
+    if (st) *st = INT_OK;
+    return T;
+}
+
+// F(x) por Hermite cúbica com F e F' = f nos extremos do painel.
+static double _eval_F(const CumTable *T, double x) {
+    double u = (x - T->lo) / T->h;
+    size_t k = (size_t)u;
+    if (k >= T->n) k = T->n - 1;
+    double t = u - (double)k;
+    if (t == 0.0) return T->F[k];
+
+    double t2 = t * t, t3 = t2 * t;
+    double h00 = 2.0 * t3 - 3.0 * t2 + 1.0;
+    double h10 = t3 - 2.0 * t2 + t;
+    double h01 = -2.0 * t3 + 3.0 * t2;
+    double h11 = t3 - t2;
+    return h00 * T->F[k] + h01 * T->F[k + 1]
+         + T->h * (h10 * T->fx[k] + h11 * T->fx[k + 1]);
+}
+
+double cumtable_query(const CumTable *T, double x0, double x1, IntegralStatus *st) {
+    if (!T) { if (st) *st = INT_ERR_NULL_FUNC; return NAN; }
+    if (!(x0 >= T->lo && x0 <= T->hi && x1 >= T->lo && x1 <= T->hi)) {
+        if (st) *st = INT_ERR_RANGE;
+        return NAN;
+    }
+    if (st) *st = INT_OK;
+    if (x0 == x1) return 0.0;
+    return _eval_F(T, x1) - _eval_F(T, x0);
+}
+
+void cumtable_free(CumTable **T) {
+    if (!T || !*T) return;
+    free((*T)->F);
+    free((*T)->fx);
+    free(*T);
+    *T = NULL;
+}
@@ -0,0 +1,176 @@
+// src/integral_gk.c
+#include "integral_gk.h"
+#include <float.h>
+#include <math.h>
+#include <stdlib.h>
+
+// Nós de Kronrod (positivos) e pesos K15/G7 (QUADPACK, qk15).
+// xgk[1], xgk[3], xgk[5] e xgk[7] são também os nós de Gauss G7.
+static const double xgk[8] = {
+    0.991455371120812639206854697526329,
+    0.949107912342758524526189684047851,
+    0.864864423359769072789712788640926,
+    0.741531185599394439863864773280788,
+    0.586087235467691130294144845693013,
+    0.405845151377397166906606412076961,
+    0.207784955007898467600689403773245,
+    0.000000000000000000000000000000000
+};
+static const double wgk[8] = {
+    0.022935322010529224963732008058970,
+    0.063092092629978553290700663189204,
+    0.104790010322250183839876322541518,
+    0.140653259715525918745189590510238,
+    0.169004726639267902826583426598550,
+    0.190350578064785409913256402421014,
+    0.204432940075298892414161999234649,
+    0.209482141084727828012999174891714
+};
+static const double wg[4] = {
+    0.129484966168869693270611432679082,
+    0.279705391489276667901467771423780,
+    0.381830050505118944950369775488975,
+    0.417959183673469387755102040816327
+};
+
+#define GK_EVALS 15
+
+typedef struct {
+    double a, b;
+    double result;
+    double err;
+} GKInterval;
+
+// Regra K15 em [a,b] com estimativa de erro no estilo QUADPACK.
+static GKInterval _qk15(Func1D f, void *ctx, double a, double b) {
+    const double c  = 0.5 * (a + b);
+    const double hw = 0.5 * (b - a);
+
+    double fc   = f(c, ctx);
+    double resg = fc * wg[3];
+    double resk = fc * wgk[7];
+    double resabs = fabs(resk);
+    double fv1[7], fv2[7];
+
+    for (int j = 0; j < 7; ++j) {
+        double dx = hw * xgk[j];
+        double f1 = f(c - dx, ctx);
+        double f2 = f(c + dx, ctx);
+        fv1[j] = f1; fv2[j] = f2;
+        resk   += wgk[j] * (f1 + f2);
+        resabs += wgk[j] * (fabs(f1) + fabs(f2));
+        if (j % 2 == 1) resg += wg[j / 2] * (f1 + f2);
+    }
+
+    double reskh  = 0.5 * resk;
+    double resasc = wgk[7] * fabs(fc - reskh);
+    for (int j = 0; j < 7; ++j)
+        resasc += wgk[j] * (fabs(fv1[j] - reskh) + fabs(fv2[j] - reskh));
+
+    resk   *= hw;
+    resg   *= hw;
+    resabs *= fabs(hw);
+    resasc *= fabs(hw);
+
+    double err = fabs(resk - resg);
+    if (resasc != 0.0 && err != 0.0)
+        err = resasc * fmin(1.0, pow(200.0 * err / resasc, 1.5));
+    if (resabs > DBL_MIN / (50.0 * DBL_EPSILON))
+        err = fmax(50.0 * DBL_EPSILON * resabs, err);
+
+    GKInterval iv = { .a = a, .b = b, .result = resk, .err = err };
+    return iv;
+}
+
+// --- Heap máximo por erro ---
+static void _heap_push(GKInterval *h, size_t *len, GKInterval iv) {
+    size_t i = (*len)++;
+    while (i > 0) {
+        size_t p = (i - 1) / 2;
+        if (h[p].err >= iv.err) break;
+        h[i] = h[p];
+        i = p;
+    }
+    h[i] = iv;
+}
+
+static GKInterval _heap_pop(GKInterval *h, size_t *len) {
+    GKInterval top = h[0];
+    GKInterval last = h[--(*len)];
+    size_t i = 0, n = *len;
+    for (;;) {
+        size_t l = 2 * i + 1, r = l + 1, m = i;
+        double em = last.err;
+        if (l < n && h[l].err > em) { m = l; em = h[l].err; }
+        if (r < n && h[r].err > em) { m = r; }
+        if (m == i) break;
+        h[i] = h[m];
+        i = m;
+    }
+    if (n > 0) h[i] = last;
+    return top;
+}
+
+double gauss_kronrod_adaptive(Func1D f, void *ctx, double a, double b,
+                              double abs_tol, double rel_tol, size_t max_evals,
+                              double *err_est, size_t *n_evals, IntegralStatus *st) {
+    if (err_est) *err_est = 0.0;
+    if (n_evals) *n_evals = 0;
+    if (!f) { if (st) *st = INT_ERR_NULL_FUNC; return NAN; }
+    if (abs_tol < 0.0 || rel_tol < 0.0 || (abs_tol <= 0.0 && rel_tol <= 0.0)) {
+        if (st) *st = INT_ERR_TOL_INVALID;
+        return NAN;
+    }
+    if (max_evals < GK_EVALS) { if (st) *st = INT_ERR_N_INVALID; return NAN; }
+    if (a == b) { if (st) *st = INT_OK; return 0.0; }
+
+    double sign = 1.0;
+    if (b < a) { double tmp = a; a = b; b = tmp; sign = -1.0; }
+
+    // Cada bisseção troca 1 intervalo por 2: no máximo max_evals/15 intervalos vivos.
+    size_t cap = max_evals / GK_EVALS + 1;
+    GKInterval *heap = (GKInterval *)malloc(cap * sizeof(GKInterval));
+    if (!heap) { if (st) *st = INT_ERR_ALLOC; return NAN; }
+
+    size_t len = 0, evals = GK_EVALS;
+    GKInterval first = _qk15(f, ctx, a, b);
+    _heap_push(heap, &len, first);
+    double result = first.result, err = first.err;
+    IntegralStatus status = INT_OK;
+
+    while (err > fmax(abs_tol, rel_tol * fabs(result))) {
+        if (evals + 2 * GK_EVALS > max_evals) { status = INT_ERR_NOT_CONVERGED; break; }
+
+        GKInterval w = _heap_pop(heap, &len);
+        double m = 0.5 * (w.a + w.b);
+        if (m <= w.a || m >= w.b) {
+            // Intervalo no limite da resolução de double: não há como refinar
+            _heap_push(heap, &len, w);
+            status = INT_ERR_NOT_CONVERGED;
+            break;
+        }
+        GKInterval l = _qk15(f, ctx, w.a, m);
+        GKInterval r = _qk15(f, ctx, m, w.b);
+        evals += 2 * GK_EVALS;
+
+        result += (l.result + r.result) - w.result;
+        err    += (l.err + r.err) - w.err;
+        _heap_push(heap, &len, l);
+        _heap_push(heap, &len, r);
+
+        // Soma incremental acumula arredondamento: recalcula de tempos em tempos
+        if (len % 64 == 0) {
+            result = 0.0; err = 0.0;
+            for (size_t i = 0; i < len; ++i) { result += heap[i].result; err += heap[i].err; }
+        }
+    }
+
+    result = 0.0; err = 0.0;
+    for (size_t i = 0; i < len; ++i) { result += heap[i].result; err += heap[i].err; }
+    free(heap);
+
+    if (err_est) *err_est = err;
+    if (n_evals) *n_evals = evals;
+    if (st) *st = status;
+    return sign * result;
+}
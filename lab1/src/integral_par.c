@@ -0,0 +1,80 @@
+// src/integral_par.c
+#include "integral_par.h"
+#include "parallel.h"
+#include <math.h>
+#include <stdlib.h>
+
+typedef enum { PAR_TRAP, PAR_SIMPSON } ParRule;
+
+typedef struct {
+    Func1D  f;
+    void   *ctx;
+    double  a, b, h;
+    size_t  n;        // nº de subintervalos (nós 0..n)
+    ParRule rule;
+    double *partial;  // uma soma ponderada por bloco
+} ParSumArgs;
+
+// Peso de cada nó, sem o fator comum (h no trapézio, h/3 no Simpson).
+static inline double _node_weight(ParRule rule, size_t k, size_t n) {
+    if (k == 0 || k == n) return (rule == PAR_TRAP) ? 0.5 : 1.0;
+    if (rule == PAR_TRAP) return 1.0;
+    return (k % 2 != 0) ? 4.0 : 2.0;
+}
+
+static void _sum_block(size_t blk, void *p) {
+    ParSumArgs *A = (ParSumArgs *)p;
+    size_t lo = blk * INTEGRAL_PAR_BLOCK;
+    size_t hi = lo + INTEGRAL_PAR_BLOCK;
+    if (hi > A->n + 1) hi = A->n + 1;
+
+    // Soma compensada (Kahan) dentro do bloco
+    double sum = 0.0, c = 0.0;
+    for (size_t k = lo; k < hi; ++k) {
+        double x = (k == A->n) ? A->b : A->a + k * A->h;
+        double y = _node_weight(A->rule, k, A->n) * A->f(x, A->ctx) - c;
+        double t = sum + y;
+        c = (t - sum) - y;
+        sum = t;
+    }
+    A->partial[blk] = sum;
+}
+
+static double _par_rule(ParRule rule, Func1D f, void *ctx, double a, double b, size_t n,
+                        unsigned nthreads, IntegralStatus *st) {
+    if (!f) { if (st) *st = INT_ERR_NULL_FUNC; return NAN; }
+    if (n == 0) { if (st) *st = INT_ERR_N_INVALID; return NAN; }
+    if (rule == PAR_SIMPSON && n % 2 != 0) { if (st) *st = INT_ERR_N_INVALID; return NAN; }
+    if (a == b) { if (st) *st = INT_OK; return 0.0; }
+
+    double sign = 1.0;
+    if (b < a) { double tmp = a; a = b; b = tmp; sign = -1.0; }
+    double h = (b - a) / (double)n;
+
+    size_t nblocks = n / INTEGRAL_PAR_BLOCK + 1; // n+1 nós
+    double *partial = (double *)malloc(nblocks * sizeof(double));
+    if (!partial) { if (st) *st = INT_ERR_ALLOC; return NAN; }
+
+    ParSumArgs args = { .f = f, .ctx = ctx, .a = a, .b = b, .h = h, .n = n,
+                        .rule = rule, .partial = partial };
+    par_for(nblocks, nthreads, _sum_block, &args);
+
+    double sum = par_pairwise_sum(partial, nblocks);
+    free(partial);
+
+    if (st) *st = INT_OK;
+    double scale = (rule == PAR_TRAP) ? h : h / 3.0;
+    return sign * scale * sum;
+}
+
+// --- Regra do Trapézio (composta, paralela) ---
+double trapezoidal_rule_par(Func1D f, void *ctx, double a, double b, size_t n,
+                            unsigned nthreads, IntegralStatus *st) {
+    return _par_rule(PAR_TRAP, f, ctx, a, b, n, nthreads, st);
+}
+
+// --- Regra de Simpson (composta, paralela) ---
+double simpson_rule_par(Func1D f, void *ctx, double a, double b, size_t n,
+                        unsigned nthreads, IntegralStatus *st) {
+    return _par_rule(PAR_SIMPSON, f, ctx, a, b, n, nthreads, st);
+}
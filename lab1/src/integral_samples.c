@@ -0,0 +1,247 @@
+// src/integral_samples.c
+#define _DEFAULT_SOURCE // madvise(MADV_SEQUENTIAL / MADV_DONTNEED)
+
+#include "integral_samples.h"
+#include <fcntl.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define READ_CHUNK    (1u << 20)  // leitura em blocos (sem mmap)
+#define RELEASE_BYTES (64u << 20) // devolve páginas mapeadas a cada 64 MiB lidos
+#define PARSE_BATCH   4096        // amostras acumuladas antes de ir para o fluxo
+
+// ----------------- Integração em fluxo -----------------
+
+static inline void _kahan_add(SampleStream *s, double v) {
+    double y = v - s->comp;
+    double t = s->sum + y;
+    s->comp = (t - s->sum) - y;
+    s->sum = t;
+}
+
+// Simpson em dois intervalos de larguras h0 e h1 (não uniforme)
+static inline double _simpson_pair(double x0, double x1, double x2, double y0, double y1, double y2) {
+    double h0 = x1 - x0, h1 = x2 - x1, hs = h0 + h1;
+    return hs / 6.0 * ((2.0 - h1 / h0) * y0 + (hs * hs / (h0 * h1)) * y1 + (2.0 - h0 / h1) * y2);
+}
+
+void sample_stream_init(SampleStream *s, SampleRule rule) {
+    if (!s) return;
+    memset(s, 0, sizeof(*s));
+    s->rule = rule;
+    s->status = INT_OK;
+}
+
+static void _push_one(SampleStream *s, double xi, double yi) {
+    if (!isfinite(xi) || isnan(yi)) { s->status = INT_ERR_DATA; return; }
+    if (s->n > 0) {
+        double last = (s->rule == SAMPLE_SIMPSON && s->open) ? s->x[2] : s->x[1];
+        if (!(xi > last)) { s->status = INT_ERR_DATA; return; }
+    }
+
+    if (s->rule == SAMPLE_TRAPEZOID) {
+        if (s->n > 0) _kahan_add(s, 0.5 * (xi - s->x[1]) * (yi + s->y[1]));
+        s->x[1] = xi; s->y[1] = yi;
+    } else if (s->n == 0) {
+        s->x[1] = xi; s->y[1] = yi;           // início do primeiro par
+    } else if (!s->open) {
+        s->x[2] = xi; s->y[2] = yi;           // meio do par
+        s->open = 1;
+    } else {
+        _kahan_add(s, _simpson_pair(s->x[1], s->x[2], xi, s->y[1], s->y[2], yi));
+        s->x[0] = s->x[2]; s->y[0] = s->y[2]; // anterior ao novo par
+        s->x[1] = xi;      s->y[1] = yi;
+        s->open = 0;
+    }
+    s->n++;
+}
+
+void sample_stream_push(SampleStream *s, const double *x, const double *y, size_t n) {
+    if (!s || !x || !y) return;
+    for (size_t i = 0; i < n && s->status == INT_OK; ++i) _push_one(s, x[i], y[i]);
+}
+
+double sample_stream_result(const SampleStream *s, IntegralStatus *st) {
+    if (!s) { if (st) *st = INT_ERR_DATA; return NAN; }
+    if (s->status != INT_OK) { if (st) *st = s->status; return NAN; }
+    if (s->n < 2) { if (st) *st = INT_ERR_N_INVALID; return NAN; }
+
+    double r = s->sum;
+    if (s->rule == SAMPLE_SIMPSON && s->open) {
+        if (s->n == 2) {
+            r += 0.5 * (s->x[2] - s->x[1]) * (s->y[2] + s->y[1]); // só um intervalo
+        } else {
+            // Intervalo final ímpar: correção de 3 pontos (exata para quadráticas)
+            double h1 = s->x[2] - s->x[1]; // último intervalo
+            double h0 = s->x[1] - s->x[0]; // penúltimo
+            double alpha = (2.0 * h1 * h1 + 3.0 * h1 * h0) / (6.0 * (h0 + h1));
+            double beta  = (h1 * h1 + 3.0 * h1 * h0) / (6.0 * h0);
+            double eta   = (h1 * h1 * h1) / (6.0 * h0 * (h0 + h1));
+            r += alpha * s->y[2] + beta * s->y[1] - eta * s->y[0];
+        }
+    }
+    if (st) *st = INT_OK;
+    return r;
+}
+
+static double _samples(SampleRule rule, const double *x, const double *y, size_t n, IntegralStatus *st) {
+    if (!x || !y) { if (st) *st = INT_ERR_DATA; return NAN; }
+    SampleStream s;
+    sample_stream_init(&s, rule);
+    sample_stream_push(&s, x, y, n);
+    return sample_stream_result(&s, st);
+}
+
+double trapezoid_samples(const double *x, const double *y, size_t n, IntegralStatus *st) {
+    return _samples(SAMPLE_TRAPEZOID, x, y, n, st);
+}
+
+double simpson_samples(const double *x, const double *y, size_t n, IntegralStatus *st) {
+    return _samples(SAMPLE_SIMPSON, x, y, n, st);
+}
+
+// ----------------- Leitura de arquivo -----------------
+
+typedef struct {
+    SampleStream s;
+    int    col_x, col_y;
+    size_t idx;              // amostras lidas (x quando col_x < 0)
+    size_t cnt;
+    double bx[PARSE_BATCH], by[PARSE_BATCH];
+} SampleReader;
+
+static void _reader_flush(SampleReader *R) {
+    sample_stream_push(&R->s, R->bx, R->by, R->cnt);
+    R->cnt = 0;
+}
+
+// Converte o campo [p, e) em double; 0 se não for numérico.
+static int _parse_field(const char *p, const char *e, double *v) {
+    char buf[64];
+    while (p < e && (*p == ' ' || *p == '\r')) p++;
+    while (e > p && (e[-1] == ' ' || e[-1] == '\r')) e--;
+    size_t len = (size_t)(e - p);
+    if (len == 0 || len >= sizeof(buf)) return 0;
+    memcpy(buf, p, len);
+    buf[len] = '\0';
+    char *end;
+    *v = strtod(buf, &end);
+    return end == buf + len;
+}
+
+static inline int _is_delim(char c) { return c == '\t' || c == ',' || c == ';' || c == ' '; }
+
+// Processa uma linha [p, e) sem '\n'. Linhas não numéricas são ignoradas.
+static void _reader_line(SampleReader *R, const char *p, const char *e) {
+    int want = (R->col_x > R->col_y) ? R->col_x : R->col_y;
+    int col = 0, got_x = (R->col_x < 0), got_y = 0;
+    double x = (double)R->idx, y = 0.0;
+
+    while (p < e && *p == ' ') p++;
+    while (p <= e && col <= want) {
+        const char *q = p;
+        while (q < e && !_is_delim(*q)) q++;
+        if (col == R->col_x) { if (!_parse_field(p, q, &x)) return; got_x = 1; }
+        if (col == R->col_y) { if (!_parse_field(p, q, &y)) return; got_y = 1; }
+        if (q >= e) break;
+        if (*q == ' ') { while (q < e && *q == ' ') q++; p = q; }
+        else p = q + 1;
+        col++;
+    }
+    if (!got_x || !got_y) return;
+
+    R->bx[R->cnt] = x;
+    R->by[R->cnt] = y;
+    R->idx++;
+    if (++R->cnt == PARSE_BATCH) _reader_flush(R);
+}
+
+static int _read_mapped(SampleReader *R, int fd, size_t size) {
+    char *map = (char *)mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (map == MAP_FAILED) return 0;
+    madvise(map, size, MADV_SEQUENTIAL);
+
+    const long page = sysconf(_SC_PAGESIZE);
+    const char *p = map, *end = map + size;
+    size_t released = 0;
+    while (p < end && R->s.status == INT_OK) {
+        const char *nl = memchr(p, '\n', (size_t)(end - p));
+        const char *e = nl ? nl : end;
+        _reader_line(R, p, e);
+        p = nl ? nl + 1 : end;
+
+        // Páginas já consumidas não serão lidas de novo: mantém o RSS constante
+        size_t done = (size_t)(p - map);
+        if (done - released >= RELEASE_BYTES) {
+            size_t upto = done - done % (size_t)page;
+            madvise(map + released, upto - released, MADV_DONTNEED);
+            released = upto;
+        }
+    }
+    _reader_flush(R);
+    munmap(map, size);
+    return 1;
+}
+
+static IntegralStatus _read_buffered(SampleReader *R, int fd) {
+    char *buf = (char *)malloc(READ_CHUNK);
+    if (!buf) return INT_ERR_ALLOC;
+    size_t carry = 0;
+    for (;;) {
+        ssize_t r = read(fd, buf + carry, READ_CHUNK - carry);
+        if (r < 0) { free(buf); return INT_ERR_IO; }
+        size_t len = carry + (size_t)r;
+        const char *p = buf, *end = buf + len;
+        const char *nl;
+        while ((nl = memchr(p, '\n', (size_t)(end - p))) != NULL) {
+            _reader_line(R, p, nl);
+            p = nl + 1;
+        }
+        carry = (size_t)(end - p);
+        if (r == 0) {
+            if (carry > 0) _reader_line(R, p, end); // última linha sem '\n'
+            break;
+        }
+        if (carry == READ_CHUNK) { free(buf); return INT_ERR_DATA; } // linha maior que o bloco
+        memmove(buf, p, carry);
+    }
+    _reader_flush(R);
+    free(buf);
+    return INT_OK;
+}
+
+double integrate_sample_file(const char *path, int col_x, int col_y, SampleRule rule,
+                             size_t *n_samples, IntegralStatus *st) {
+    if (n_samples) *n_samples = 0;
+    if (!path || col_y < 0) { if (st) *st = INT_ERR_IO; return NAN; }
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) { if (st) *st = INT_ERR_IO; return NAN; }
+
+    SampleReader *R = (SampleReader *)malloc(sizeof(SampleReader));
+    if (!R) { close(fd); if (st) *st = INT_ERR_ALLOC; return NAN; }
+    sample_stream_init(&R->s, rule);
+    R->col_x = col_x;
+    R->col_y = col_y;
+    R->idx = 0;
+    R->cnt = 0;
+
+    IntegralStatus io = INT_OK;
+    struct stat sb;
+    int mapped = 0;
+    if (fstat(fd, &sb) == 0 && S_ISREG(sb.st_mode) && sb.st_size > 0)
+        mapped = _read_mapped(R, fd, (size_t)sb.st_size);
+    if (!mapped) io = _read_buffered(R, fd);
+    close(fd);
+
+    double res = NAN;
+    if (io == INT_OK) res = sample_stream_result(&R->s, &io);
+    if (n_samples) *n_samples = R->s.n;
+    free(R);
+    if (st) *st = io;
+    return res;
+}
@@ -0,0 +1,50 @@
+// src/integral_sweep.c
+#include "integral_sweep.h"
+#include <math.h>
+#include <string.h>
+
+void integral_all_rules(Func1D f, void *ctx, double a, double b, size_t n,
+                        IntegralAllRules *out, IntegralStatus *st) {
+    if (!out || !f) { if (st) *st = INT_ERR_NULL_FUNC; return; }
+    memset(out, 0, sizeof(*out));
+    if (n == 0) {
+        out->left = out->right = out->midpoint = out->trapezoidal = NAN;
+        out->simpson = out->simpson_2n = out->err_trapezoidal = out->err_midpoint = NAN;
+        if (st) *st = INT_ERR_N_INVALID;
+        return;
+    }
+    if (a == b) {
+        if (n % 2 != 0) out->simpson = NAN;
+        if (st) *st = INT_OK;
+        return;
+    }
+
+    double sign = 1.0;
+    if (b < a) { double tmp = a; a = b; b = tmp; sign = -1.0; }
+    double h = (b - a) / (double)n;
+
+    // Uma passada: nós interiores (pares/ímpares separados) e pontos médios
+    double f0 = f(a, ctx), fn = f(b, ctx);
+    double s_odd = 0.0, s_even = 0.0, s_mid = 0.0;
+    for (size_t k = 0; k < n; ++k) {
+        s_mid += f(a + (k + 0.5) * h, ctx);
+        if (k == 0) continue;
+        double fk = f(a + k * h, ctx);
+        if (k % 2 != 0) s_odd += fk;
+        else            s_even += fk;
+    }
+    double s_int = s_odd + s_even;
+
+    double T = h * (0.5 * (f0 + fn) + s_int);
+    double M = h * s_mid;
+    out->left        = sign * h * (f0 + s_int);
+    out->right       = sign * h * (s_int + fn);
+    out->midpoint    = sign * M;
+    out->trapezoidal = sign * T;
+    out->simpson     = (n % 2 == 0) ? sign * (h / 3.0) * (f0 + fn + 4.0 * s_odd + 2.0 * s_even) : NAN;
+    out->simpson_2n  = sign * (T + 2.0 * M) / 3.0;
+    out->err_trapezoidal = sign * (2.0 / 3.0) * (M - T);
+    out->err_midpoint    = sign * (T - M) / 3.0;
+    out->n_evals = 2 * n + 1;
+    if (st) *st = INT_OK;
+}
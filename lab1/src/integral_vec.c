@@ -0,0 +1,122 @@
+// src/integral_vec.c
+#include "integral_vec.h"
+#include "integral_gl.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef enum { VEC_MID, VEC_TRAP, VEC_SIMPSON } VecRule;
+
+static void _fill(double *out, size_t m, double v) {
+    for (size_t j = 0; j < m; ++j) out[j] = v;
+}
+
+// acc += w * v, componente a componente (sem aliasing: vetoriza)
+static inline void _axpy(double *restrict acc, const double *restrict v, double w, size_t m) {
+    for (size_t j = 0; j < m; ++j) acc[j] += w * v[j];
+}
+
+static inline void _scale(double *acc, double s, size_t m) {
+    for (size_t j = 0; j < m; ++j) acc[j] *= s;
+}
+
+// Validação comum; retorna 0 (e preenche out com NAN) em erro.
+static int _validate(FuncVec f, size_t n, size_t m, double *out, IntegralStatus *st) {
+    IntegralStatus e = INT_OK;
+    if (!f || !out) e = INT_ERR_NULL_FUNC;
+    else if (n == 0) e = INT_ERR_N_INVALID;
+    else if (m == 0) e = INT_ERR_DIM_INVALID;
+    if (e == INT_OK) return 1;
+    if (out) _fill(out, m, NAN);
+    if (st) *st = e;
+    return 0;
+}
+
+static void _newton_cotes_vec(VecRule rule, FuncVec f, void *ctx, double a, double b, size_t n,
+                              size_t m, double *out, IntegralStatus *st) {
+    if (!_validate(f, n, m, out, st)) return;
+    if (rule == VEC_SIMPSON && n % 2 != 0) { _fill(out, m, NAN); if (st) *st = INT_ERR_N_INVALID; return; }
+    _fill(out, m, 0.0);
+    if (a == b) { if (st) *st = INT_OK; return; }
+
+    double *v = (double *)malloc(m * sizeof(double));
+    if (!v) { _fill(out, m, NAN); if (st) *st = INT_ERR_ALLOC; return; }
+
+    double sign = 1.0;
+    if (b < a) { double tmp = a; a = b; b = tmp; sign = -1.0; }
+    double h = (b - a) / (double)n;
+
+    if (rule == VEC_MID) {
+        for (size_t i = 0; i < n; ++i) {
+            f(a + (i + 0.5) * h, v, m, ctx);
+            _axpy(out, v, 1.0, m);
+        }
+        _scale(out, sign * h, m);
+    } else {
+        double w_end = (rule == VEC_TRAP) ? 0.5 : 1.0;
+        f(a, v, m, ctx);
+        _axpy(out, v, w_end, m);
+        f(b, v, m, ctx);
+        _axpy(out, v, w_end, m);
+        for (size_t i = 1; i < n; ++i) {
+            double w = (rule == VEC_TRAP) ? 1.0 : ((i % 2 != 0) ? 4.0 : 2.0);
+            f(a + i * h, v, m, ctx);
+            _axpy(out, v, w, m);
+        }
+        _scale(out, sign * ((rule == VEC_TRAP) ? h : h / 3.0), m);
+    }
+    free(v);
+    if (st) *st = INT_OK;
+}
+
+void midpoint_rule_vec(FuncVec f, void *ctx, double a, double b, size_t n,
+                       size_t m, double *out, IntegralStatus *st) {
+    _newton_cotes_vec(VEC_MID, f, ctx, a, b, n, m, out, st);
+}
+
+void trapezoidal_rule_vec(FuncVec f, void *ctx, double a, double b, size_t n,
+                          size_t m, double *out, IntegralStatus *st) {
+    _newton_cotes_vec(VEC_TRAP, f, ctx, a, b, n, m, out, st);
+}
+
+void simpson_rule_vec(FuncVec f, void *ctx, double a, double b, size_t n,
+                      size_t m, double *out, IntegralStatus *st) {
+    _newton_cotes_vec(VEC_SIMPSON, f, ctx, a, b, n, m, out, st);
+}
+
+void gauss_legendre_vec(FuncVec f, void *ctx, double a, double b, size_t n,
+                        unsigned order, size_t m, double *out, IntegralStatus *st) {
+    if (!_validate(f, n, m, out, st)) return;
+    const double *x, *w;
+    size_t half = gauss_legendre_table(order, &x, &w);
+    if (half == 0) { _fill(out, m, NAN); if (st) *st = INT_ERR_ORDER_INVALID; return; }
+    _fill(out, m, 0.0);
+    if (a == b) { if (st) *st = INT_OK; return; }
+
+    double *v = (double *)malloc(m * sizeof(double));
+    if (!v) { _fill(out, m, NAN); if (st) *st = INT_ERR_ALLOC; return; }
+
+    double sign = 1.0;
+    if (b < a) { double tmp = a; a = b; b = tmp; sign = -1.0; }
+    double h  = (b - a) / (double)n;
+    double hw = 0.5 * h;
+    size_t pairs = (order % 2 == 1) ? half - 1 : half;
+
+    for (size_t p = 0; p < n; ++p) {
+        double c = a + ((double)p + 0.5) * h;
+        if (order % 2 == 1) {
+            f(c, v, m, ctx);
+            _axpy(out, v, w[half - 1], m);
+        }
+        for (size_t i = 0; i < pairs; ++i) {
+            double dx = hw * x[i];
+            f(c - dx, v, m, ctx);
+            _axpy(out, v, w[i], m);
+            f(c + dx, v, m, ctx);
+            _axpy(out, v, w[i], m);
+        }
+    }
+    _scale(out, sign * hw, m);
+    free(v);
+    if (st) *st = INT_OK;
+}
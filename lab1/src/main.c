@@ -9,7 +9,19 @@
 #include <math.h>
 #include <string.h>
 #include <stdlib.h>
+#include <time.h>
 #include "integral.h"
+#include "integral_par.h"
+#include "integral_gk.h"
+#include "integral_romberg.h"
+#include "integral_gl.h"
+#include "cubature.h"
+#include "integral_batch.h"
+#include "integral_samples.h"
+#include "integral_de.h"
+#include "integral_sweep.h"
+#include "integral_cum.h"
+#include "integral_vec.h"
 
 // --- Definições portáveis para constantes matemáticas (caso não existam) ---
 #ifndef M_PI
@@ -88,6 +100,90 @@ static double f_const(double x, void* ctx) { (void)x; return ((ConstCtx*)ctx)->c
 typedef struct { double a, b; } LinCtx;
 static double f_lin(double x, void* ctx) { LinCtx* L = (LinCtx*)ctx; return L->a * x + L->b; }
 
+static double f_sqrt(double x, void* ctx) { (void)ctx; return sqrt(x); }
+
+// Pico estreito 1/(eps^2 + x^2): "região difícil" que força n alto nas regras uniformes
+typedef struct { double eps; } PeakCtx;
+static double f_peak(double x, void* ctx) { double e = ((PeakCtx*)ctx)->eps; return 1.0 / (e*e + x*x); }
+
+// Custo artificial: várias avaliações de seno por nó (integrando "caro").
+static double f_sin_heavy(double x, void* ctx) {
+    (void)ctx;
+    double s = 0.0;
+    for (int k = 1; k <= 16; ++k) s += sin(x * k) / k;
+    return s;
+}
+
+// Adaptadores das versões paralelas para a assinatura IntegratorFn (4 threads)
+static double trapezoidal_par4(Func1D f, void* ctx, double a, double b, size_t n, IntegralStatus* st) {
+    return trapezoidal_rule_par(f, ctx, a, b, n, 4, st);
+}
+static double simpson_par4(Func1D f, void* ctx, double a, double b, size_t n, IntegralStatus* st) {
+    return simpson_rule_par(f, ctx, a, b, n, 4, st);
+}
+
+// Gauss-Legendre de ordem 8 com a assinatura IntegratorFn
+static double gauss_legendre8(Func1D f, void* ctx, double a, double b, size_t n, IntegralStatus* st) {
+    return gauss_legendre_rule(f, ctx, a, b, n, 8, st);
+}
+
+// Monômio x^k (k no ctx), usado para verificar o grau de exatidão
+static double f_pow(double x, void* ctx) { return pow(x, *(int*)ctx); }
+
+// Integrandos com singularidade na extremidade / domínio infinito
+static double f_inv_sqrt(double x, void* ctx) { (void)ctx; return 1.0 / sqrt(x); }
+static double f_log(double x, void* ctx) { (void)ctx; return log(x); }
+static double f_exp_neg(double x, void* ctx) { (void)ctx; return exp(-x); }
+static double f_lorentz(double x, void* ctx) { (void)ctx; return 1.0 / (1.0 + x*x); }
+static double f_gauss1d(double x, void* ctx) { (void)ctx; return exp(-x*x); }
+
+// sin(x) contando avaliações (para verificar compartilhamento de nós)
+typedef struct { size_t calls; } CountCtx;
+static double f_sin_count(double x, void* ctx) { ((CountCtx*)ctx)->calls++; return sin(x); }
+
+// ---------- Integrandos N-D em lote (cubature.h) ----------
+
+// Π x_d
+static void fnd_prod(const double* x, size_t count, unsigned dim, double* out, void* ctx) {
+    (void)ctx;
+    for (size_t i = 0; i < count; ++i) {
+        double p = 1.0;
+        for (unsigned d = 0; d < dim; ++d) p *= x[i*dim + d];
+        out[i] = p;
+    }
+}
+
+// exp(-|x|^2)
+static void fnd_gauss(const double* x, size_t count, unsigned dim, double* out, void* ctx) {
+    (void)ctx;
+    for (size_t i = 0; i < count; ++i) {
+        double r2 = 0.0;
+        for (unsigned d = 0; d < dim; ++d) r2 += x[i*dim + d] * x[i*dim + d];
+        out[i] = exp(-r2);
+    }
+}
+
+// Função-g de Sobol: Π (|4x_d - 2| + a_d) / (1 + a_d), integral 1 em [0,1]^d (a_d = d)
+static void fnd_sobol_g(const double* x, size_t count, unsigned dim, double* out, void* ctx) {
+    (void)ctx;
+    for (size_t i = 0; i < count; ++i) {
+        double p = 1.0;
+        for (unsigned d = 0; d < dim; ++d) p *= (fabs(4.0*x[i*dim + d] - 2.0) + d) / (1.0 + d);
+        out[i] = p;
+    }
+}
+
+static void count_reports(size_t n_evals, double est, double err, void* user) {
+    (void)n_evals; (void)est; (void)err;
+    (*(int*)user)++;
+}
+
+static double wall_seconds(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (double)ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
 // ---------- Blocos de teste ----------
 
 static void run_numeric_test(
@@ -139,6 +235,533 @@ static void run_error_test(
     CHECK(st == expected_status, "Status de erro conforme esperado");
 }
 
+// Mesma integral com 1..32 threads: valores devem ser idênticos bit a bit.
+// Imprime o tempo de cada execução para acompanhar a escalabilidade.
+static void run_parallel_scaling_test(
+    const char* method_name,
+    double (*integrator_par)(Func1D, void*, double, double, size_t, unsigned, IntegralStatus*),
+    Func1D f, void* ctx, double a, double b, size_t n,
+    int *passes, int *fails, int verbose
+) {
+    printf("\n== Determinismo/escala paralela | Método: %s ==\n", method_name);
+    static const unsigned threads[] = {1, 2, 4, 8, 16, 32};
+    const size_t nthr = sizeof(threads) / sizeof(threads[0]);
+
+    double ref = 0.0, t_ref = 0.0;
+    int all_ok = 1, all_equal = 1;
+    for (size_t i = 0; i < nthr; ++i) {
+        IntegralStatus st = -999;
+        double t0 = wall_seconds();
+        double got = integrator_par(f, ctx, a, b, n, threads[i], &st);
+        double dt = wall_seconds() - t0;
+        if (i == 0) { ref = got; t_ref = dt; }
+        if (st != INT_OK) all_ok = 0;
+        if (memcmp(&got, &ref, sizeof(double)) != 0) all_equal = 0;
+        if (verbose) {
+            printf("  threads=%2u  valor=%.17g  tempo=%.4f s  speedup=%.2fx\n",
+                   threads[i], got, dt, (dt > 0.0) ? t_ref / dt : 0.0);
+        }
+    }
+    CHECK(all_ok, "Status INT_OK para todas as contagens de threads");
+    CHECK(all_equal, "Resultado idêntico bit a bit para 1..32 threads");
+}
+
+// Adaptativo vs Simpson uniforme: mesmo erro-alvo, compara nº de avaliações.
+static void run_adaptive_test(
+    const char* title,
+    Func1D f, void* ctx, double a, double b,
+    double expected, double tol,
+    int *passes, int *fails, int verbose
+) {
+    printf("\n== %s | Método: Gauss-Kronrod adaptativo ==\n", title);
+    IntegralStatus st = -999;
+    double err_est = 0.0;
+    size_t evals = 0;
+    double got = gauss_kronrod_adaptive(f, ctx, a, b, tol, 0.0, 1000000, &err_est, &evals, &st);
+
+    // Simpson uniforme dobrando n até atingir a mesma tolerância (custo n+1)
+    size_t n_simp = 2, simp_evals = 0;
+    for (; n_simp <= ((size_t)1 << 24); n_simp *= 2) {
+        IntegralStatus sst;
+        double s = simpson_rule(f, ctx, a, b, n_simp, &sst);
+        if (fabs(s - expected) <= tol) break;
+    }
+    simp_evals = n_simp + 1;
+
+    if (verbose) {
+        printf("  Intervalo   : [%.10g, %.10g], tol = %.3g\n", a, b, tol);
+        printf("  Esperado    : %.15g\n", expected);
+        printf("  Obtido      : %.15g (erro real %.3g, estimado %.3g)\n",
+               got, fabs(got - expected), err_est);
+        printf("  Avaliações  : GK=%zu  Simpson=%zu  (%.1fx)\n",
+               evals, simp_evals, (double)simp_evals / (double)evals);
+        printf("  Status      : %d\n", st);
+    }
+    CHECK(st == INT_OK, "Status deve ser INT_OK");
+    CHECK(almost_equal(got, expected, tol), "Valor dentro da tolerância pedida");
+    CHECK(fabs(got - expected) <= err_est + 1e-15, "Erro estimado cobre o erro real");
+    CHECK(evals < simp_evals, "Menos avaliações que Simpson uniforme");
+}
+
+// Casos de borda do Gauss-Kronrod: sinal, orçamento e tolerância inválida
+static void run_adaptive_edge_tests(int *passes, int *fails, int verbose) {
+    printf("\n== Gauss-Kronrod: intervalo invertido, orçamento e tolerância ==\n");
+    IntegralStatus st = -999;
+    double err = 0.0;
+    size_t evals = 0;
+    double g = gauss_kronrod_adaptive(f_sin, NULL, M_PI, 0.0, 1e-12, 0.0, 10000, &err, &evals, &st);
+    if (verbose) printf("  [pi,0]: got=%.15g err=%.3g evals=%zu st=%d\n", g, err, evals, st);
+    CHECK(st == INT_OK && almost_equal(g, -2.0, 1e-12), "Intervalo invertido troca o sinal");
+
+    PeakCtx P = {.eps = 1e-6};
+    g = gauss_kronrod_adaptive(f_peak, &P, -1.0, 1.0, 1e-14, 0.0, 45, &err, &evals, &st);
+    if (verbose) printf("  orçamento 45: evals=%zu st=%d\n", evals, st);
+    CHECK(st == INT_ERR_NOT_CONVERGED && evals <= 45, "Orçamento esgotado sinaliza INT_ERR_NOT_CONVERGED");
+
+    g = gauss_kronrod_adaptive(f_sin, NULL, 0.0, 1.0, 0.0, 0.0, 1000, &err, &evals, &st);
+    CHECK(st == INT_ERR_TOL_INVALID, "Tolerâncias nulas devem falhar");
+    (void)g;
+}
+
+// Romberg incremental: refinar de novo com tolerância menor só paga pelos nós novos.
+static void run_romberg_test(
+    const char* title,
+    Func1D f, void* ctx, double a, double b, double expected,
+    int *passes, int *fails, int verbose
+) {
+    printf("\n== %s | Método: Romberg incremental ==\n", title);
+    RombergState R;
+    IntegralStatus st = -999;
+    romberg_init(&R, f, ctx, a, b, &st);
+    CHECK(st == INT_OK, "romberg_init retorna INT_OK");
+
+    double err1 = 0.0, err2 = 0.0;
+    double g1 = romberg_refine_until(&R, 1e-6, 0.0, ROMBERG_MAX_LEVEL, &err1, &st);
+    int lvl1 = R.level;
+    size_t ev1 = R.n_evals;
+    CHECK(st == INT_OK && almost_equal(g1, expected, 1e-6), "Tolerância 1e-6 atingida");
+
+    double g2 = romberg_refine_until(&R, 1e-13, 0.0, ROMBERG_MAX_LEVEL, &err2, &st);
+    int lvl2 = R.level;
+    size_t ev2 = R.n_evals;
+    CHECK(st == INT_OK && almost_equal(g2, expected, 1e-12), "Tolerância 1e-13 atingida");
+
+    // Nós distintos no nível k: 2^k + 1 -> nenhuma reavaliação
+    CHECK(ev1 == ((size_t)1 << lvl1) + 1 && ev2 == ((size_t)1 << lvl2) + 1,
+          "Avaliações = 2^k + 1 (só pontos médios novos)");
+
+    IntegralStatus tst;
+    double T = trapezoidal_rule(f, ctx, a, b, (size_t)1 << lvl2, &tst);
+    CHECK(almost_equal(romberg_trapezoid(&R), T, 1e-13), "Trapézio do nível k igual a trapezoidal_rule(n=2^k)");
+
+    if (verbose) {
+        printf("  tol 1e-6 : valor=%.15g nível=%d avaliações=%zu err=%.3g\n", g1, lvl1, ev1, err1);
+        printf("  tol 1e-13: valor=%.15g nível=%d avaliações=%zu err=%.3g\n", g2, lvl2, ev2, err2);
+        printf("  Esperado : %.15g\n", expected);
+    }
+}
+
+// Tabelas de Gauss-Legendre: ordem m integra x^(2m-1) exatamente em [0,1].
+static void run_gauss_legendre_exactness_test(int *passes, int *fails, int verbose) {
+    printf("\n== Gauss-Legendre: exatidão polinomial, ordens %d..%d ==\n", GL_MIN_ORDER, GL_MAX_ORDER);
+    int all_ok = 1;
+    for (unsigned m = GL_MIN_ORDER; m <= GL_MAX_ORDER; ++m) {
+        int k = (int)(2 * m - 1);
+        IntegralStatus st = -999;
+        double got = gauss_legendre_rule(f_pow, &k, 0.0, 1.0, 1, m, &st);
+        double expected = 1.0 / (double)(k + 1);
+        if (st != INT_OK || !almost_equal(got, expected, 1e-14)) {
+            all_ok = 0;
+            printf("  ordem %u: got=%.17g esperado=%.17g st=%d\n", m, got, expected, st);
+        }
+    }
+    CHECK(all_ok, "Ordem m exata para grau 2m-1 (todas as ordens)");
+
+    IntegralStatus st1 = -999, st2 = -999;
+    gauss_legendre_rule(f_x2, NULL, 0.0, 1.0, 1, GL_MIN_ORDER - 1, &st1);
+    gauss_legendre_rule(f_x2, NULL, 0.0, 1.0, 1, GL_MAX_ORDER + 1, &st2);
+    if (verbose) printf("  ordem %d: st=%d | ordem %d: st=%d\n", GL_MIN_ORDER - 1, st1, GL_MAX_ORDER + 1, st2);
+    CHECK(st1 == INT_ERR_ORDER_INVALID && st2 == INT_ERR_ORDER_INVALID, "Ordem fora da faixa deve falhar");
+}
+
+// Avaliações x erro: Gauss-Legendre (várias ordens) contra Simpson, mesmo orçamento.
+static void run_gauss_legendre_vs_simpson(
+    const char* title, Func1D f, void* ctx, double a, double b, double expected,
+    int *passes, int *fails, int verbose
+) {
+    printf("\n== %s | Avaliações x erro: Gauss-Legendre vs Simpson ==\n", title);
+    static const size_t budgets[] = {16, 64, 256, 1024};
+    static const unsigned orders[] = {4, 8, 16};
+    int gl_wins = 1;
+    if (verbose) printf("  %8s %12s %12s %12s %12s\n", "aval.", "Simpson", "GL-4", "GL-8", "GL-16");
+    for (size_t i = 0; i < sizeof(budgets) / sizeof(budgets[0]); ++i) {
+        IntegralStatus st;
+        size_t E = budgets[i];
+        double e_simp = fabs(simpson_rule(f, ctx, a, b, E, &st) - expected); // E+1 avaliações
+        double e_gl[3];
+        for (size_t j = 0; j < 3; ++j)
+            e_gl[j] = fabs(gauss_legendre_rule(f, ctx, a, b, E / orders[j], orders[j], &st) - expected);
+        if (verbose) printf("  %8zu %12.3e %12.3e %12.3e %12.3e\n", E, e_simp, e_gl[0], e_gl[1], e_gl[2]);
+        if (e_gl[1] > e_simp && e_simp > 1e-15) gl_wins = 0;
+    }
+    CHECK(gl_wins, "GL-8 com o mesmo nº de avaliações tem erro <= Simpson");
+}
+
+// Cubatura N-D: Gauss tensorial (dim baixa) e QMC de Sobol (dim alta)
+static void run_cubature_tests(int *passes, int *fails, int verbose) {
+    printf("\n== Cubatura N-D | Gauss tensorial e QMC de Sobol ==\n");
+    IntegralStatus st = -999;
+    double err = 0.0;
+    size_t evals = 0;
+
+    {
+        const double lo[3] = {0.0, 0.0, 0.0}, hi[3] = {1.0, 1.0, 1.0};
+        double g = cubature_gauss(fnd_prod, NULL, 3, lo, hi, 4, 1, 4, &err, &evals, &st);
+        if (verbose) printf("  Gauss ∫ xyz [0,1]^3: %.15g (esp. 0.125) err=%.3g aval.=%zu\n", g, err, evals);
+        CHECK(st == INT_OK && almost_equal(g, 0.125, 1e-15), "Gauss tensorial exato para Π x_d");
+    }
+    {
+        const double lo[2] = {-1.0, -1.0}, hi[2] = {1.0, 1.0};
+        const double expected = M_PI * erf(1.0) * erf(1.0);
+        double g1 = cubature_gauss(fnd_gauss, NULL, 2, lo, hi, 8, 4, 1, &err, &evals, &st);
+        double g4 = cubature_gauss(fnd_gauss, NULL, 2, lo, hi, 8, 4, 4, NULL, NULL, &st);
+        if (verbose) printf("  Gauss ∫ exp(-r^2) [-1,1]^2: %.15g (esp. %.15g) err=%.3g aval.=%zu\n",
+                            g1, expected, err, evals);
+        CHECK(st == INT_OK && almost_equal(g1, expected, 1e-13), "Gauss tensorial em exp(-r^2)");
+        CHECK(memcmp(&g1, &g4, sizeof(double)) == 0, "Gauss tensorial idêntico com 1 e 4 threads");
+        CHECK(fabs(g1 - expected) <= err + 1e-15, "Erro estimado (ordem vizinha) cobre o erro real");
+    }
+    {
+        const unsigned dim = 8;
+        double lo[8], hi[8];
+        for (unsigned d = 0; d < dim; ++d) { lo[d] = 0.0; hi[d] = 1.0; }
+        int reports = 0;
+        double q1 = cubature_qmc(fnd_sobol_g, NULL, dim, lo, hi, 1u << 22, 1e-4, 0.0, 1,
+                                 count_reports, &reports, &err, &evals, &st);
+        double q4 = cubature_qmc(fnd_sobol_g, NULL, dim, lo, hi, 1u << 22, 1e-4, 0.0, 4,
+                                 NULL, NULL, NULL, NULL, &st);
+        if (verbose) printf("  QMC g-Sobol d=8: %.10g (esp. 1) err=%.3g aval.=%zu relatórios=%d\n",
+                            q1, err, evals, reports);
+        CHECK(st == INT_OK && err <= 1e-4, "QMC atinge a tolerância pedida");
+        CHECK(almost_equal(q1, 1.0, 5e-4), "QMC dentro de 5x o erro pedido");
+        CHECK(reports >= 1, "QMC reporta estimativa parcial por rodada");
+        CHECK(memcmp(&q1, &q4, sizeof(double)) == 0, "QMC idêntico com 1 e 4 threads");
+
+        const double lo2[2] = {-1.0, -1.0}, hi2[2] = {1.0, 1.0};
+        double g = cubature_qmc(fnd_gauss, NULL, 2, lo2, hi2, 8 * 1024, 1e-15, 0.0, 2,
+                                NULL, NULL, &err, &evals, &st);
+        if (verbose) printf("  QMC orçamento 8192: %.10g err=%.3g aval.=%zu st=%d\n", g, err, evals, st);
+        CHECK(st == INT_ERR_NOT_CONVERGED && evals <= 8 * 1024, "QMC sinaliza orçamento esgotado");
+    }
+    {
+        const double lo[1] = {0.0}, hi[1] = {1.0};
+        cubature_gauss(fnd_prod, NULL, 0, lo, hi, 4, 1, 1, NULL, NULL, &st);
+        CHECK(st == INT_ERR_DIM_INVALID, "dim = 0 deve falhar");
+        cubature_qmc(fnd_prod, NULL, CUBATURE_MAX_DIM + 1, lo, hi, 1u << 20, 1e-3, 0.0, 1,
+                     NULL, NULL, NULL, NULL, &st);
+        CHECK(st == INT_ERR_DIM_INVALID, "dim > CUBATURE_MAX_DIM deve falhar");
+    }
+}
+
+// Lote de intervalos: janelas deslizantes (grade comum) e ctx por intervalo.
+static void run_batch_tests(int *passes, int *fails, int verbose) {
+    printf("\n== Integração em lote | Simpson/Trapézio ==\n");
+    enum { M = 1000, N = 100 };
+    static double a[M], b[M], out[M], ref[M];
+    static IntegralStatus sts[M];
+    IntegralStatus st = -999, sst;
+
+    // Janelas [k*h, k*h + 1] com h = 1/N: todos os nós caem na mesma grade
+    for (int i = 0; i < M; ++i) { a[i] = i * (1.0 / N); b[i] = a[i] + 1.0; }
+    b[7] = a[7];                                      // intervalo nulo no meio
+    { double t = a[9]; a[9] = b[9]; b[9] = t; }       // intervalo invertido
+
+    CountCtx C = {0};
+    simpson_rule_batch(f_sin_count, &C, NULL, a, b, M, N, out, sts, &st);
+    int all_ok = (st == INT_OK), max_ok = 1;
+    for (int i = 0; i < M; ++i) {
+        ref[i] = simpson_rule(f_sin, NULL, a[i], b[i], N, &sst);
+        if (sts[i] != INT_OK) all_ok = 0;
+        if (!almost_equal(out[i], ref[i], 1e-12)) max_ok = 0;
+    }
+    if (verbose) printf("  Janelas deslizantes: %d intervalos, n=%d -> %zu avaliações (vs %d)\n",
+                        M, N, C.calls, M * (N + 1));
+    CHECK(all_ok, "Status INT_OK em todo o lote");
+    CHECK(max_ok, "Lote (grade comum) igual a simpson_rule por intervalo");
+    CHECK(C.calls <= (size_t)(M + N + 1), "Nós coincidentes avaliados uma única vez");
+
+    trapezoidal_rule_batch(f_sin, NULL, NULL, a, b, M, N, out, NULL, &st);
+    max_ok = (st == INT_OK);
+    for (int i = 0; i < M; ++i)
+        if (!almost_equal(out[i], trapezoidal_rule(f_sin, NULL, a[i], b[i], N, &sst), 1e-12)) max_ok = 0;
+    CHECK(max_ok, "Trapézio em lote igual a trapezoidal_rule por intervalo");
+
+    // Contexto por intervalo (caminho SoA): f_lin com coeficientes diferentes
+    static LinCtx L[M];
+    static void *ctxs[M];
+    for (int i = 0; i < M; ++i) {
+        L[i].a = 0.01 * i; L[i].b = 1.0 - 0.002 * i;
+        ctxs[i] = &L[i];
+        a[i] = -1.0 + 0.003 * i; b[i] = 2.0 + 0.0071 * i;
+    }
+    simpson_rule_batch(f_lin, NULL, ctxs, a, b, M, 10, out, sts, &st);
+    max_ok = (st == INT_OK);
+    for (int i = 0; i < M; ++i) {
+        double e = 0.5*L[i].a*(b[i]*b[i] - a[i]*a[i]) + L[i].b*(b[i] - a[i]);
+        if (!almost_equal(out[i], e, 1e-12)) max_ok = 0;
+    }
+    CHECK(max_ok, "Lote com ctx por intervalo (SoA) exato para ax+b");
+
+    simpson_rule_batch(f_sin, NULL, NULL, a, b, M, 9, out, sts, &st);
+    if (verbose) printf("  n ímpar: st=%d, st_out[0]=%d\n", st, sts[0]);
+    CHECK(st == INT_ERR_N_INVALID && sts[0] == INT_ERR_N_INVALID && isnan(out[0]),
+          "Simpson em lote com n ímpar falha para o lote inteiro");
+}
+
+// Dados amostrados: vetores não uniformes, fluxo em pedaços e arquivo TSV/CSV.
+static void run_samples_tests(int *passes, int *fails, int verbose) {
+    printf("\n== Integração de amostras | vetores, fluxo e arquivo ==\n");
+    enum { NS = 2001 };
+    static double x[NS], y[NS], q[NS];
+    IntegralStatus st = -999;
+
+    // Malha não uniforme (mais densa perto de 0) em [0, pi]
+    for (int i = 0; i < NS; ++i) {
+        double u = (double)i / (NS - 1);
+        x[i] = M_PI * u * u;
+        y[i] = sin(x[i]);
+        q[i] = x[i] * x[i];
+    }
+    double tr = trapezoid_samples(x, y, NS, &st);
+    CHECK(st == INT_OK && almost_equal(tr, 2.0, 1e-5), "Trapézio não uniforme em sin");
+    double sp = simpson_samples(x, y, NS, &st);
+    CHECK(st == INT_OK && almost_equal(sp, 2.0, 1e-10), "Simpson não uniforme em sin");
+    // NS-1 = 2000 intervalos (par) e NS-2 = 1999 (ímpar, usa a correção final)
+    double e1 = simpson_samples(x, q, NS, &st);
+    double e2 = simpson_samples(x, q, NS - 1, &st);
+    CHECK(almost_equal(e1, pow(x[NS-1], 3) / 3.0, 1e-12) && almost_equal(e2, pow(x[NS-2], 3) / 3.0, 1e-12),
+          "Simpson não uniforme exato para x^2 (nº de intervalos par e ímpar)");
+    if (verbose) printf("  trapézio=%.15g simpson=%.15g (esp. 2)\n", tr, sp);
+
+    // Fluxo em pedaços de tamanhos variados == vetor inteiro (bit a bit)
+    SampleStream S;
+    sample_stream_init(&S, SAMPLE_SIMPSON);
+    for (size_t i = 0, c = 1; i < NS; i += c, c = c * 3 % 17 + 1)
+        sample_stream_push(&S, x + i, y + i, (i + c <= NS) ? c : NS - i);
+    double sr = sample_stream_result(&S, &st);
+    CHECK(st == INT_OK && memcmp(&sr, &sp, sizeof(double)) == 0, "Fluxo em pedaços igual ao vetor inteiro");
+
+    // Arquivo no formato de lab2/out/sim_out.tsv: ∫ v dt com v = cos(t)
+    const char* tsv = "test_samples.tsv";
+    FILE* fp = fopen(tsv, "w");
+    if (fp) {
+        fprintf(fp, "t(s)\tv(m/s)\tw(rad/s)\tyx(m)\tyy(m)\n");
+        for (int i = 0; i <= 4000; ++i) {
+            double t = 0.005 * i;
+            fprintf(fp, "%.17g\t%.17g\t0\t0\t0\n", t, cos(t));
+        }
+        fclose(fp);
+    }
+    size_t ns = 0;
+    double fv = integrate_sample_file(tsv, 0, 1, SAMPLE_SIMPSON, &ns, &st);
+    if (verbose) printf("  arquivo: %zu amostras, ∫ cos = %.15g (esp. %.15g)\n", ns, fv, sin(20.0));
+    CHECK(st == INT_OK && ns == 4001 && almost_equal(fv, sin(20.0), 1e-10), "Arquivo TSV (mmap) com cabeçalho");
+    remove(tsv);
+
+    // CSV sem coluna de tempo (x = índice) e última linha sem '\n'
+    const char* csv = "test_samples.csv";
+    fp = fopen(csv, "w");
+    if (fp) { fprintf(fp, "y1,y2\n1,0\n1,1\n1,4\n1,9"); fclose(fp); }
+    fv = integrate_sample_file(csv, -1, 1, SAMPLE_SIMPSON, &ns, &st);
+    CHECK(st == INT_OK && ns == 4 && almost_equal(fv, 9.0, 1e-12), "Arquivo CSV com x = índice (∫_0^3 x^2 = 9)");
+    remove(csv);
+
+    // Erros
+    double xb[3] = {0.0, 1.0, 1.0}, yb[3] = {0.0, 1.0, 2.0};
+    trapezoid_samples(xb, yb, 3, &st);
+    CHECK(st == INT_ERR_DATA, "x não estritamente crescente deve falhar");
+    simpson_samples(xb, yb, 1, &st);
+    CHECK(st == INT_ERR_N_INVALID, "Menos de 2 amostras deve falhar");
+    integrate_sample_file("nao_existe.tsv", 0, 1, SAMPLE_TRAPEZOID, NULL, &st);
+    CHECK(st == INT_ERR_IO, "Arquivo inexistente deve falhar com INT_ERR_IO");
+}
+
+// Tanh-sinh: precisão dupla com poucas centenas de avaliações.
+static void run_tanh_sinh_test(
+    const char* title, Func1D f, void* ctx, double a, double b, double expected,
+    int *passes, int *fails, int verbose
+) {
+    printf("\n== %s | Método: tanh-sinh ==\n", title);
+    IntegralStatus st = -999;
+    double err = 0.0;
+    size_t evals = 0;
+    double got = tanh_sinh_rule(f, ctx, a, b, 0.0, 1e-13, DE_MAX_LEVEL, &err, &evals, &st);
+    if (verbose) {
+        printf("  Intervalo   : [%g, %g]\n", a, b);
+        printf("  Obtido      : %.16g (esp. %.16g, erro real %.3g, estimado %.3g)\n",
+               got, expected, fabs(got - expected), err);
+        printf("  Avaliações  : %zu  Status: %d\n", evals, st);
+    }
+    CHECK(st == INT_OK, "Status deve ser INT_OK");
+    CHECK(almost_equal(got, expected, 1e-13 * fmax(1.0, fabs(expected))), "Precisão próxima de double");
+    CHECK(evals <= 600, "Poucas centenas de avaliações");
+}
+
+// Varredura única sobre sin(x): todas as regras com 2n+1 avaliações, iguais às chamadas separadas.
+static void run_all_rules_test(
+    const char* title, void* ctx, double a, double b, size_t n, double expected,
+    int *passes, int *fails, int verbose
+) {
+    printf("\n== %s | Método: varredura única (todas as regras) ==\n", title);
+    IntegralAllRules R;
+    IntegralStatus st = -999, s;
+    CountCtx C = {0};
+    integral_all_rules(f_sin_count, &C, a, b, n, &R, &st);
+
+    const double tol = 1e-12 * fmax(1.0, fabs(expected));
+    int same = almost_equal(R.left,        riemann_left(f_sin, ctx, a, b, n, &s), tol)
+            && almost_equal(R.right,       riemann_right(f_sin, ctx, a, b, n, &s), tol)
+            && almost_equal(R.midpoint,    midpoint_rule(f_sin, ctx, a, b, n, &s), tol)
+            && almost_equal(R.trapezoidal, trapezoidal_rule(f_sin, ctx, a, b, n, &s), tol)
+            && (n % 2 != 0 ? isnan(R.simpson)
+                           : almost_equal(R.simpson, simpson_rule(f_sin, ctx, a, b, n, &s), tol));
+    double real_err_T = expected - R.trapezoidal;
+    if (verbose) {
+        printf("  L=%.12g R=%.12g M=%.12g T=%.12g S=%.12g S2n=%.15g\n",
+               R.left, R.right, R.midpoint, R.trapezoidal, R.simpson, R.simpson_2n);
+        printf("  Richardson: erro T estimado %.3g (real %.3g) | avaliações %zu (separadas: %zu)\n",
+               R.err_trapezoidal, real_err_T, C.calls, 5 * n + 2);
+    }
+    CHECK(st == INT_OK, "Status deve ser INT_OK");
+    CHECK(same, "Mesmos valores das regras separadas");
+    CHECK(C.calls == 2 * n + 1 && R.n_evals == C.calls, "2n+1 avaliações");
+    CHECK(fabs(R.err_trapezoidal - real_err_T) <= 0.01 * fabs(real_err_T), "Estimativa de Richardson do trapézio");
+    CHECK(almost_equal(R.simpson_2n, expected, 1e-10), "Simpson na malha refinada");
+}
+
+// Tabela cumulativa: muitas consultas ∫_{x0}^{x1} sin em O(1) cada.
+static void run_cumtable_tests(int *passes, int *fails, int verbose) {
+    printf("\n== Tabela cumulativa de sin(x) em [0,pi] | consultas O(1) ==\n");
+    const size_t n = 20000; // > INTEGRAL_PAR_BLOCK: vários blocos na soma prefixada
+    IntegralStatus st = -999, s1 = -999, s4 = -999;
+    CountCtx C = {0};
+    CumTable *T1 = cumtable_build(f_sin_count, &C, 0.0, M_PI, n, 1, &s1);
+    CumTable *T4 = cumtable_build(f_sin, NULL, M_PI, 0.0, n, 4, &s4);
+    CHECK(T1 && T4 && s1 == INT_OK && s4 == INT_OK, "Construção deve retornar INT_OK");
+    if (!T1 || !T4) { cumtable_free(&T1); cumtable_free(&T4); return; }
+
+    size_t blocks = (n + INTEGRAL_PAR_BLOCK - 1) / INTEGRAL_PAR_BLOCK;
+    CHECK(C.calls == 2 * n + blocks, "2n+1 avaliações (+1 por fronteira de bloco)");
+    CHECK(memcmp(T1->F, T4->F, (n + 1) * sizeof(double)) == 0, "Tabela idêntica para 1 e 4 threads");
+
+    // Consultas pseudoaleatórias (LCG fixo) contra cos(x0) - cos(x1)
+    unsigned long long seed = 12345;
+    double max_err = 0.0;
+    int all_ok = 1;
+    const int Q = 100000;
+    double t0 = wall_seconds();
+    for (int q = 0; q < Q; ++q) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        double x0 = M_PI * (double)(seed >> 11) / 9007199254740992.0;
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        double x1 = M_PI * (double)(seed >> 11) / 9007199254740992.0;
+        double r = cumtable_query(T1, x0, x1, &st);
+        all_ok &= (st == INT_OK);
+        double e = fabs(r - (cos(x0) - cos(x1)));
+        if (e > max_err) max_err = e;
+    }
+    double t_q = (wall_seconds() - t0) / Q;
+    t0 = wall_seconds();
+    (void)trapezoidal_rule(f_sin, NULL, 0.3, 2.1, 1000, &st);
+    double t_trap = wall_seconds() - t0;
+    if (verbose) {
+        printf("  %d consultas: erro máx %.3e | %.1f ns/consulta (trapézio n=1000: %.1f us)\n",
+               Q, max_err, 1e9 * t_q, 1e6 * t_trap);
+    }
+    CHECK(all_ok, "Consultas dentro do domínio devem retornar INT_OK");
+    CHECK(max_err < 1e-12, "Erro das consultas < 1e-12");
+
+    double fwd = cumtable_query(T1, 0.25, 2.5, &st);
+    double bwd = cumtable_query(T1, 2.5, 0.25, &st);
+    CHECK(fwd == -bwd, "x0 > x1 troca o sinal");
+    CHECK(cumtable_query(T1, 0.0, M_PI, &st) == T1->F[n] && almost_equal(T1->F[n], 2.0, 1e-13),
+          "Domínio inteiro igual a F[n]");
+
+    double r = cumtable_query(T1, -0.1, 1.0, &st);
+    CHECK(isnan(r) && st == INT_ERR_RANGE, "Consulta fora do domínio deve dar INT_ERR_RANGE");
+    CumTable *E = cumtable_build(f_sin, NULL, 1.0, 1.0, 10, 1, &st);
+    CHECK(!E && st == INT_ERR_RANGE, "Domínio vazio deve dar INT_ERR_RANGE");
+    E = cumtable_build(NULL, NULL, 0.0, 1.0, 10, 1, &st);
+    CHECK(!E && st == INT_ERR_NULL_FUNC, "Função nula deve dar INT_ERR_NULL_FUNC");
+
+    cumtable_free(&T1);
+    cumtable_free(&T4);
+    CHECK(T1 == NULL && T4 == NULL, "cumtable_free zera o ponteiro");
+}
+
+// Momentos x^j, j = 0..m-1, por recorrência (uma chamada por nó para as m saídas)
+static void fv_moments(double x, double *out, size_t m, void *ctx) {
+    ((CountCtx*)ctx)->calls++;
+    double p = 1.0;
+    for (size_t j = 0; j < m; ++j) { out[j] = p; p *= x; }
+}
+
+typedef void (*VecIntegratorFn)(FuncVec, void*, double, double, size_t, size_t, double*, IntegralStatus*);
+
+// Integrandos vetoriais: cada componente igual à regra escalar, com 1 chamada por nó.
+static void run_vec_tests(int *passes, int *fails, int verbose) {
+    enum { M = 16 };
+    const size_t n = 1000;
+    struct { const char *name; VecIntegratorFn vec; IntegratorFn scalar; size_t calls; } rules[] = {
+        {"ponto médio", midpoint_rule_vec,    midpoint_rule,    n},
+        {"trapézio",    trapezoidal_rule_vec, trapezoidal_rule, n + 1},
+        {"Simpson",     simpson_rule_vec,     simpson_rule,     n + 1},
+    };
+    for (size_t r = 0; r < sizeof(rules) / sizeof(rules[0]); ++r) {
+        printf("\n== ∫ x^j dx em [0,1], j = 0..%d | Método: %s vetorial ==\n", M - 1, rules[r].name);
+        double out[M], t_vec, t_scalar;
+        IntegralStatus st = -999, s;
+        CountCtx C = {0};
+        double t0 = wall_seconds();
+        rules[r].vec(fv_moments, &C, 0.0, 1.0, n, M, out, &st);
+        t_vec = wall_seconds() - t0;
+
+        int same = 1;
+        t0 = wall_seconds();
+        for (int j = 0; j < M; ++j) {
+            double ref = rules[r].scalar(f_pow, &j, 0.0, 1.0, n, &s);
+            same &= almost_equal(out[j], ref, 1e-13);
+        }
+        t_scalar = wall_seconds() - t0;
+        if (verbose) {
+            printf("  x^0: %.15f | x^15: %.15f (exato %.15f)\n", out[0], out[M - 1], 1.0 / M);
+            printf("  chamadas: %zu | tempo vetorial %.1f us vs %d escalares %.1f us\n",
+                   C.calls, 1e6 * t_vec, M, 1e6 * t_scalar);
+        }
+        CHECK(st == INT_OK, "Status deve ser INT_OK");
+        CHECK(same, "Cada componente igual à regra escalar");
+        CHECK(C.calls == rules[r].calls, "Uma chamada do callback por nó");
+    }
+
+    printf("\n== ∫ x^j dx em [1,0], j = 0..15 | Método: Gauss-Legendre vetorial (ordem 8) ==\n");
+    double out[M];
+    IntegralStatus st = -999;
+    CountCtx C = {0};
+    gauss_legendre_vec(fv_moments, &C, 1.0, 0.0, 4, 8, M, out, &st);
+    int exact = 1;
+    for (int j = 0; j < M; ++j) exact &= almost_equal(out[j], -1.0 / (j + 1), 1e-14);
+    CHECK(st == INT_OK, "Status deve ser INT_OK");
+    CHECK(exact, "Exata até grau 15 com sinal trocado (a > b)");
+    CHECK(C.calls == 4 * 8, "n*ordem chamadas");
+
+    simpson_rule_vec(fv_moments, &C, 0.0, 1.0, 7, M, out, &st);
+    CHECK(st == INT_ERR_N_INVALID && isnan(out[0]), "Simpson vetorial com n ímpar deve falhar");
+    trapezoidal_rule_vec(fv_moments, &C, 0.0, 1.0, 8, 0, out, &st);
+    CHECK(st == INT_ERR_DIM_INVALID, "m = 0 deve dar INT_ERR_DIM_INVALID");
+    gauss_legendre_vec(fv_moments, &C, 0.0, 1.0, 8, 1, M, out, &st);
+    CHECK(st == INT_ERR_ORDER_INVALID, "Ordem inválida deve dar INT_ERR_ORDER_INVALID");
+}
+
 static void run_zero_interval_test(
     IntegratorFn integrator, const char* method_name,
     Func1D f, void* ctx, double a,
@@ -328,6 +951,116 @@ int main(void) {
                    simpson_rule, "Simpson (composta)",
                    f_x2, NULL, 0.0, 1.0, 9, INT_ERR_N_INVALID, &passes, &fails, verbose);
 
+    // 4) Versões paralelas (integral_par.h)
+
+    run_numeric_test("∫ x^2 dx em [0,1]",
+                     trapezoidal_par4, "Trapézio paralelo",
+                     f_x2, NULL, 0.0, 1.0, 1000, 1.0/3.0,
+                     &passes, &fails, verbose);
+
+    run_numeric_test("∫ sin(x) dx em [0,pi]",
+                     simpson_par4, "Simpson paralelo",
+                     f_sin, NULL, 0.0, M_PI, 100000, 2.0,
+                     &passes, &fails, verbose);
+
+    run_inverted_interval_test(simpson_par4, "Simpson paralelo",
+                               f_x2, NULL, 0.0, 1.0, 1000, 1.0/3.0, &passes, &fails, verbose);
+    run_zero_interval_test(trapezoidal_par4, "Trapézio paralelo", f_x2, NULL, 2.0, &passes, &fails, verbose);
+
+    run_error_test("Simpson paralelo com n ímpar deve falhar",
+                   simpson_par4, "Simpson paralelo",
+                   f_x2, NULL, 0.0, 1.0, 9, INT_ERR_N_INVALID, &passes, &fails, verbose);
+
+    run_error_test("f == NULL deve falhar",
+                   trapezoidal_par4, "Trapézio paralelo",
+                   NULL, NULL, 0.0, 1.0, 10, INT_ERR_NULL_FUNC, &passes, &fails, verbose);
+
+    run_parallel_scaling_test("Trapézio paralelo", trapezoidal_rule_par,
+                              f_sin_heavy, NULL, 0.0, M_PI, 1000000, &passes, &fails, verbose);
+    run_parallel_scaling_test("Simpson paralelo", simpson_rule_par,
+                              f_sin_heavy, NULL, 0.0, M_PI, 1000000, &passes, &fails, verbose);
+
+    // 5) Gauss-Kronrod adaptativo (integral_gk.h)
+
+    {
+        PeakCtx P = {.eps = 1e-3};
+        run_adaptive_test("∫ 1/(eps^2+x^2) dx em [-1,1]", f_peak, &P, -1.0, 1.0,
+                          (2.0 / P.eps) * atan(1.0 / P.eps), 1e-8, &passes, &fails, verbose);
+    }
+    run_adaptive_test("∫ sqrt(x) dx em [0,1]", f_sqrt, NULL, 0.0, 1.0,
+                      2.0 / 3.0, 1e-10, &passes, &fails, verbose);
+    run_adaptive_test("∫ (1/x) dx em [1,e]", f_inv, NULL, 1.0, M_E,
+                      1.0, 1e-12, &passes, &fails, verbose);
+
+    run_adaptive_edge_tests(&passes, &fails, verbose);
+
+    // 6) Romberg incremental (integral_romberg.h)
+
+    run_romberg_test("∫ sin(x) dx em [0,pi]", f_sin, NULL, 0.0, M_PI, 2.0, &passes, &fails, verbose);
+    run_romberg_test("∫ (1/x) dx em [e,1]", f_inv, NULL, M_E, 1.0, -1.0, &passes, &fails, verbose);
+
+    // 7) Gauss-Legendre composta (integral_gl.h)
+
+    run_gauss_legendre_exactness_test(&passes, &fails, verbose);
+
+    run_numeric_test("∫ sin(x) dx em [0,pi]",
+                     gauss_legendre8, "Gauss-Legendre 8 (n=4)",
+                     f_sin, NULL, 0.0, M_PI, 4, 2.0,
+                     &passes, &fails, verbose);
+    run_inverted_interval_test(gauss_legendre8, "Gauss-Legendre 8",
+                               f_x2, NULL, 0.0, 1.0, 1, 1.0/3.0, &passes, &fails, verbose);
+    run_zero_interval_test(gauss_legendre8, "Gauss-Legendre 8", f_x2, NULL, 2.0, &passes, &fails, verbose);
+    run_error_test("n == 0 deve falhar",
+                   gauss_legendre8, "Gauss-Legendre 8",
+                   f_x2, NULL, 0.0, 1.0, 0, INT_ERR_N_INVALID, &passes, &fails, verbose);
+
+    run_gauss_legendre_vs_simpson("∫ (1/x) dx em [1,e]", f_inv, NULL, 1.0, M_E, 1.0,
+                                  &passes, &fails, verbose);
+    run_gauss_legendre_vs_simpson("∫ sin(x) dx em [0,pi]", f_sin, NULL, 0.0, M_PI, 2.0,
+                                  &passes, &fails, verbose);
+
+    // 8) Cubatura multidimensional (cubature.h)
+
+    run_cubature_tests(&passes, &fails, verbose);
+
+    // 9) Integração em lote (integral_batch.h)
+
+    run_batch_tests(&passes, &fails, verbose);
+
+    // 10) Dados amostrados (integral_samples.h)
+
+    run_samples_tests(&passes, &fails, verbose);
+
+    // 11) Dupla exponencial (integral_de.h)
+
+    run_tanh_sinh_test("∫ 1/sqrt(x) dx em [0,1]", f_inv_sqrt, NULL, 0.0, 1.0, 2.0, &passes, &fails, verbose);
+    run_tanh_sinh_test("∫ log(x) dx em [0,1]", f_log, NULL, 0.0, 1.0, -1.0, &passes, &fails, verbose);
+    run_tanh_sinh_test("∫ sin(x) dx em [pi,0]", f_sin, NULL, M_PI, 0.0, -2.0, &passes, &fails, verbose);
+    run_tanh_sinh_test("∫ exp(-x) dx em [0,inf)", f_exp_neg, NULL, 0.0, INFINITY, 1.0, &passes, &fails, verbose);
+    run_tanh_sinh_test("∫ exp(-x^2) dx em (-inf,0]", f_gauss1d, NULL, -INFINITY, 0.0, 0.5 * sqrt(M_PI),
+                       &passes, &fails, verbose);
+    run_tanh_sinh_test("∫ 1/(1+x^2) dx em (-inf,inf)", f_lorentz, NULL, -INFINITY, INFINITY, M_PI,
+                       &passes, &fails, verbose);
+    {
+        // Referência: ponto médio (não avalia x = 0) precisa de n enorme para 1/sqrt(x)
+        IntegralStatus st;
+        double mid = midpoint_rule(f_inv_sqrt, NULL, 0.0, 1.0, 1000000, &st);
+        printf("  (ponto médio, n=1e6, em 1/sqrt(x): erro %.3g)\n", fabs(mid - 2.0));
+    }
+
+    // 12) Varredura única com todas as regras (integral_sweep.h)
+
+    run_all_rules_test("∫ sin(x) dx em [0,pi]", NULL, 0.0, M_PI, 1000, 2.0, &passes, &fails, verbose);
+    run_all_rules_test("∫ sin(x) dx em [pi,0], n ímpar", NULL, M_PI, 0.0, 999, -2.0, &passes, &fails, verbose);
+
+    // 13) Tabela cumulativa com consultas O(1) (integral_cum.h)
+
+    run_cumtable_tests(&passes, &fails, verbose);
+
+    // 14) Integrandos vetoriais (integral_vec.h)
+
+    run_vec_tests(&passes, &fails, verbose);
+
     printf("\n================= RESUMO DOS TESTES =================\n");
     printf("Passes: %d\nFalhas: %d\n", passes, fails);
     printf("=====================================================\n");
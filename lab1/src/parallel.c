@@ -0,0 +1,86 @@
+// src/parallel.c
+#define _DEFAULT_SOURCE // sysconf(_SC_NPROCESSORS_ONLN)
+
+#include "parallel.h"
+#include <pthread.h>
+#include <stdatomic.h>
+#include <unistd.h>
+
+#define PAR_MAX_THREADS 256
+
+typedef struct {
+    atomic_size_t next;    // próximo bloco ainda não reservado
+    size_t        nblocks;
+    ParBlockFn    fn;      // um dos dois é não nulo
+    ParWorkerFn   fnw;
+    void         *arg;
+} ParJob;
+
+typedef struct {
+    ParJob  *job;
+    unsigned id;
+} ParSeat;
+
+static void *_worker(void *p) {
+    ParSeat *seat = (ParSeat *)p;
+    ParJob *job = seat->job;
+    for (;;) {
+        size_t blk = atomic_fetch_add_explicit(&job->next, 1, memory_order_relaxed);
+        if (blk >= job->nblocks) break;
+        if (job->fn) job->fn(blk, job->arg);
+        else job->fnw(blk, seat->id, job->arg);
+    }
+    return NULL;
+}
+
+unsigned par_default_threads(void) {
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    if (n < 1) return 1;
+    if (n > PAR_MAX_THREADS) return PAR_MAX_THREADS;
+    return (unsigned)n;
+}
+
+unsigned par_threads(size_t nblocks, unsigned nthreads) {
+    if (nthreads == 0) nthreads = par_default_threads();
+    if (nthreads > PAR_MAX_THREADS) nthreads = PAR_MAX_THREADS;
+    if ((size_t)nthreads > nblocks) nthreads = (unsigned)nblocks;
+    return nthreads ? nthreads : 1;
+}
+
+static void _run(ParJob *job, unsigned nthreads) {
+    atomic_init(&job->next, 0);
+    pthread_t th[PAR_MAX_THREADS];
+    ParSeat seat[PAR_MAX_THREADS];
+    unsigned started = 0;
+    for (unsigned t = 1; t < nthreads; ++t) {
+        seat[t] = (ParSeat){ .job = job, .id = t };
+        if (pthread_create(&th[started], NULL, _worker, &seat[t]) != 0) break;
+        started++;
+    }
+    seat[0] = (ParSeat){ .job = job, .id = 0 };
+    _worker(&seat[0]); // a thread chamadora também consome blocos
+    for (unsigned t = 0; t < started; ++t) pthread_join(th[t], NULL);
+}
+
+void par_for(size_t nblocks, unsigned nthreads, ParBlockFn fn, void *arg) {
+    if (!fn || nblocks == 0) return;
+    ParJob job = { .nblocks = nblocks, .fn = fn, .arg = arg };
+    _run(&job, par_threads(nblocks, nthreads));
+}
+
+void par_for_worker(size_t nblocks, unsigned nthreads, ParWorkerFn fn, void *arg) {
+    if (!fn || nblocks == 0) return;
+    ParJob job = { .nblocks = nblocks, .fnw = fn, .arg = arg };
+    _run(&job, par_threads(nblocks, nthreads));
+}
+
+double par_pairwise_sum(const double *v, size_t n) {
+    if (n == 0) return 0.0;
+    if (n <= 8) {
+        double s = v[0];
+        for (size_t i = 1; i < n; ++i) s += v[i];
+        return s;
+    }
+    size_t m = n / 2;
+    return par_pairwise_sum(v, m) + par_pairwise_sum(v + m, n - m);
+}
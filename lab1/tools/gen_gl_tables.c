@@ -0,0 +1,75 @@
+// tools/gen_gl_tables.c
+//
+// Gera (em tempo de build) as tabelas de nós e pesos de Gauss-Legendre para
+// as ordens GL_MIN_ORDER..GL_MAX_ORDER. A iteração de Newton roda aqui, em
+// long double; a biblioteca só enxerga arrays "static const double".
+// Uso (feito pelo Makefile):  ./gen_gl_tables > obj/gen/gl_tables.h
+
+#include <math.h>
+#include <stdio.h>
+
+#define GL_MIN_ORDER 2
+#define GL_MAX_ORDER 64
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846264338327950288419716939937510
+#endif
+
+// Avalia P_n(z) e P_n'(z) pela recorrência de Bonnet.
+static void legendre(int n, long double z, long double *p, long double *dp) {
+    long double p0 = 1.0L, p1 = z;
+    for (int j = 2; j <= n; ++j) {
+        long double p2 = ((2.0L * j - 1.0L) * z * p1 - (j - 1.0L) * p0) / j;
+        p0 = p1;
+        p1 = p2;
+    }
+    *p = p1;
+    *dp = n * (z * p1 - p0) / (z * z - 1.0L);
+}
+
+int main(void) {
+    static long double xs[GL_MAX_ORDER * GL_MAX_ORDER], ws[GL_MAX_ORDER * GL_MAX_ORDER];
+    int off[GL_MAX_ORDER + 2] = {0};
+    int total = 0;
+
+    for (int n = GL_MIN_ORDER; n <= GL_MAX_ORDER; ++n) {
+        off[n] = total;
+        int half = (n + 1) / 2;
+        for (int i = 1; i <= half; ++i) {
+            long double z = cosl((long double)M_PI * (i - 0.25L) / (n + 0.5L));
+            long double p, dp;
+            for (int it = 0; it < 100; ++it) {
+                legendre(n, z, &p, &dp);
+                long double dz = p / dp;
+                z -= dz;
+                if (fabsl(dz) <= 1e-19L * fabsl(z) || fabsl(dz) < 1e-30L) break;
+            }
+            if (n % 2 == 1 && i == half) z = 0.0L; // raiz central exata
+            legendre(n, z, &p, &dp);
+            xs[total] = z;
+            ws[total] = 2.0L / ((1.0L - z * z) * dp * dp);
+            total++;
+        }
+    }
+    off[GL_MAX_ORDER + 1] = total;
+
+    printf("// gl_tables.h — GERADO por tools/gen_gl_tables.c, não editar.\n");
+    printf("// Nós não negativos (decrescentes) e pesos de Gauss-Legendre em [-1,1].\n");
+    printf("// Ordem m: posições gl_off[m] .. gl_off[m+1]-1; para m ímpar o último nó é 0.\n");
+    printf("#ifndef GL_TABLES_H\n#define GL_TABLES_H\n\n");
+    printf("#define GL_TABLE_MIN_ORDER %d\n#define GL_TABLE_MAX_ORDER %d\n\n", GL_MIN_ORDER, GL_MAX_ORDER);
+
+    printf("static const unsigned short gl_off[%d] = {", GL_MAX_ORDER + 2);
+    for (int n = 0; n <= GL_MAX_ORDER + 1; ++n)
+        printf("%s%d,", (n % 12 == 0) ? "\n    " : " ", (n < GL_MIN_ORDER) ? 0 : off[n]);
+    printf("\n};\n\n");
+
+    printf("static const double gl_x[%d] = {\n", total);
+    for (int i = 0; i < total; ++i) printf("    %.21Le,\n", xs[i]);
+    printf("};\n\n");
+
+    printf("static const double gl_w[%d] = {\n", total);
+    for (int i = 0; i < total; ++i) printf("    %.21Le,\n", ws[i]);
+    printf("};\n\n#endif // GL_TABLES_H\n");
+    return 0;
+}
@@ -0,0 +1,137 @@
+// bench_batch.c
+// Robô-passos/s do RK4 em lote (SoA + sincos polinomial vetorizado) contra o
+// caminho escalar (um SimRobot por robô, sim_step com sin/cos da libm).
+//   $ make bench      (gera out/bench_batch.csv)
+//   $ ./lab2_bench_batch [saida.csv] [passos]
+#define _POSIX_C_SOURCE 200809L
+
+#include "robot_batch.h"
+#include "sim_robot.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846264338327950288419716939937510
+#endif
+
+#define DT 0.05
+#define D_ROBOT 0.30
+
+static inline long long now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (long long)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+// Entradas diferentes por robô (constantes no tempo)
+static void robot_input(size_t i, double *v, double *w)
+{
+    *v = 1.0 + 0.001 * (double)(i % 101);
+    *w = 0.2 * M_PI * (1.0 - 2.0 * (double)(i % 7) / 7.0);
+}
+
+// Maior erro relativo de sincos_poly contra a libm numa varredura de [-1e4, 1e4]
+static double sincos_max_err(void)
+{
+    double err = 0.0;
+    for (int i = -1000000; i <= 1000000; ++i)
+    {
+        double x = 0.01 * i + 1e-3 * (i % 13), s, c;
+        robot_batch_sincos(x, &s, &c);
+        double es = fabs(s - sin(x)), ec = fabs(c - cos(x));
+        if (es > err) err = es;
+        if (ec > err) err = ec;
+    }
+    return err;
+}
+
+int main(int argc, char **argv)
+{
+    const char *out_path = (argc >= 2) ? argv[1] : "out/bench_batch.csv";
+    int steps = (argc >= 3) ? atoi(argv[2]) : 2000;
+    if (steps < 10)
+        steps = 10;
+
+    FILE *fp = fopen(out_path, "w");
+    if (!fp)
+    {
+        perror(out_path);
+        return 1;
+    }
+    fprintf(fp, "robots,steps,scalar_steps_per_s,batch_steps_per_s,speedup,max_abs_diff\n");
+    printf("sincos polinomial: erro absoluto máx %.3e em [-1e4, 1e4]\n", sincos_max_err());
+    printf("%8s %16s %16s %8s %12s\n", "robos", "escalar(p/s)", "lote(p/s)", "ganho", "dif.max(m)");
+
+    const size_t sizes[] = {8, 64, 512, 4096, 32768};
+    for (size_t si = 0; si < sizeof(sizes) / sizeof(sizes[0]); ++si)
+    {
+        size_t n = sizes[si];
+        int st = (int)((size_t)steps * 4096 / (n > 4096 ? n : 4096)); // ~mesmo trabalho total
+        if (st < 10)
+            st = 10;
+
+        // ---- Escalar ----
+        SimParams params = {.dt = DT, .t_end = DT * st, .D = D_ROBOT};
+        SimRobot **R = malloc(n * sizeof(SimRobot *));
+        double *ref_x = malloc(n * sizeof(double)), *ref_y = malloc(n * sizeof(double));
+        if (!R || !ref_x || !ref_y)
+        {
+            perror("malloc");
+            return 1;
+        }
+        for (size_t i = 0; i < n; ++i)
+            R[i] = sim_create(&params);
+        long long t0 = now_ns();
+        for (size_t i = 0; i < n; ++i)
+        {
+            double v, w, t_next, th;
+            robot_input(i, &v, &w);
+            for (int k = 0; k < st; ++k)
+                sim_step(R[i], v, w, &t_next, &ref_x[i], &ref_y[i], &th);
+        }
+        double scalar = (double)n * st / ((now_ns() - t0) / 1e9);
+
+        // ---- Lote ----
+        RobotBatch B;
+        double *yx = malloc(n * sizeof(double)), *yy = malloc(n * sizeof(double));
+        if (robot_batch_init(&B, n) != 0 || !yx || !yy)
+        {
+            perror("robot_batch_init");
+            return 1;
+        }
+        for (size_t i = 0; i < n; ++i)
+            robot_input(i, &B.v[i], &B.w[i]);
+        t0 = now_ns();
+        for (int k = 0; k < st; ++k)
+            robot_batch_rk4(&B, DT);
+        double batch = (double)n * st / ((now_ns() - t0) / 1e9);
+
+        robot_batch_front(&B, D_ROBOT, yx, yy);
+        double diff = 0.0;
+        for (size_t i = 0; i < n; ++i)
+        {
+            double d = fmax(fabs(yx[i] - ref_x[i]), fabs(yy[i] - ref_y[i]));
+            if (d > diff)
+                diff = d;
+        }
+
+        fprintf(fp, "%zu,%d,%.1f,%.1f,%.2f,%.3e\n", n, st, scalar, batch, batch / scalar, diff);
+        printf("%8zu %16.0f %16.0f %7.2fx %12.3e\n", n, scalar, batch, batch / scalar, diff);
+
+        for (size_t i = 0; i < n; ++i)
+            sim_destroy(&R[i]);
+        free(R);
+        free(ref_x);
+        free(ref_y);
+        free(yx);
+        free(yy);
+        robot_batch_free(&B);
+    }
+    fclose(fp);
+    printf("OK: %s gerado.\n", out_path);
+    return 0;
+}
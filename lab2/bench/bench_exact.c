@@ -0,0 +1,158 @@
+// bench_exact.c
+// Passos/s e erro dos integradores de sim_step (RK4, RK45, EXACT) contra a
+// solução fechada do uniciclo avaliada em long double diretamente de theta.
+//   $ make bench      (gera out/bench_exact.csv)
+//   $ ./lab2_bench_exact [saida.csv] [passos]
+#define _POSIX_C_SOURCE 200809L
+
+#include "sim_robot.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define D_ROBOT 0.30
+
+static inline long long now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (long long)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+// Cenários de entrada (constante por passo)
+typedef void (*InputFn)(long k, double dt, double *v, double *w);
+
+// Lei do laboratório (trajetória fecha em t = 20 s: o erro final se cancela)
+static void input_lab(long k, double dt, double *v, double *w)
+{
+    simrobot_generate_u(k * dt, v, w);
+}
+
+// Entradas variando a cada passo, com trechos de w ~ 0 (ramo da série)
+static void input_var(long k, double dt, double *v, double *w)
+{
+    double t = k * dt;
+    *v = 1.0 + 0.5 * cos(0.7 * t);
+    *w = (k % 400 < 100) ? 1e-7 * sin(t) : 1.5 * sin(0.37 * t) + 0.3 * cos(1.3 * t);
+}
+
+// Referência: mesma fórmula fechada, mas em long double e com sin/cos de theta a cada passo
+typedef struct
+{
+    long double x, y, th;
+} RefState;
+
+static void ref_step(RefState *S, double v, double w, double dt)
+{
+    long double h = 0.5L * (long double)w * dt;
+    long double sinc = (fabsl(h) < 1e-6L) ? 1.0L - h * h / 6.0L : sinl(h) / h;
+    long double L = (long double)v * dt * sinc, mid = S->th + h;
+    S->x += L * sinl(mid);
+    S->y += L * cosl(mid);
+    S->th += (long double)w * dt;
+}
+
+// Maior distância do ponto frontal à referência ao longo da trajetória
+static double run_error(SimIntegrator integ, InputFn in, double dt, long steps)
+{
+    SimParams p = {.dt = dt, .t_end = dt * steps, .D = D_ROBOT, .integrator = integ,
+                   .rtol = 1e-10, .atol = 1e-12};
+    SimRobot *R = sim_create(&p);
+    RefState S = {0.0L, 0.0L, 0.0L};
+    double err = 0.0;
+    for (long k = 0; k < steps; ++k)
+    {
+        double v, w, yx, yy;
+        in(k, dt, &v, &w);
+        sim_step(R, v, w, NULL, &yx, &yy, NULL);
+        ref_step(&S, v, w, dt);
+        long double rx = S.x + 0.5L * D_ROBOT * cosl(S.th), ry = S.y + 0.5L * D_ROBOT * sinl(S.th);
+        double e = (double)sqrtl((yx - rx) * (yx - rx) + (yy - ry) * (yy - ry));
+        if (e > err)
+            err = e;
+    }
+    sim_destroy(&R);
+    return err;
+}
+
+// Passos/s: entradas pré-computadas para medir só sim_step
+static double run_speed(SimIntegrator integ, const double *u, double dt, long steps)
+{
+    SimParams p = {.dt = dt, .t_end = dt * steps, .D = D_ROBOT, .integrator = integ,
+                   .rtol = 1e-10, .atol = 1e-12};
+    SimRobot *R = sim_create(&p);
+    double yx = 0.0, yy = 0.0, sink = 0.0;
+    long long t0 = now_ns();
+    for (long k = 0; k < steps; ++k)
+    {
+        sim_step(R, u[2 * k], u[2 * k + 1], NULL, &yx, &yy, NULL);
+        sink += yx;
+    }
+    double s = (now_ns() - t0) / 1e9;
+    sim_destroy(&R);
+    if (sink == 12345.678) // impede que o laço seja descartado
+        puts("");
+    return steps / s;
+}
+
+int main(int argc, char **argv)
+{
+    const char *out_path = (argc >= 2) ? argv[1] : "out/bench_exact.csv";
+    long steps = (argc >= 3) ? atol(argv[2]) : 1000000;
+    if (steps < 1000)
+        steps = 1000;
+
+    FILE *fp = fopen(out_path, "w");
+    if (!fp)
+    {
+        perror(out_path);
+        return 1;
+    }
+    fprintf(fp, "integrator,input,dt,steps_per_s,max_err_m\n");
+    printf("%-6s %-4s %6s %14s %12s\n", "integ", "u", "dt", "passos/s", "erro max(m)");
+
+    const struct
+    {
+        const char *name;
+        SimIntegrator id;
+    } integ[] = {{"rk4", SIM_RK4}, {"rk45", SIM_RK45}, {"exact", SIM_EXACT}};
+    const struct
+    {
+        const char *name;
+        InputFn fn;
+    } inputs[] = {{"lab", input_lab}, {"var", input_var}};
+    const double dts[] = {0.01, 0.05, 0.2};
+
+    double *u = malloc(2 * (size_t)steps * sizeof(double));
+    if (!u)
+    {
+        perror("malloc");
+        return 1;
+    }
+    for (size_t ii = 0; ii < sizeof(inputs) / sizeof(inputs[0]); ++ii)
+    {
+        for (size_t di = 0; di < sizeof(dts) / sizeof(dts[0]); ++di)
+        {
+            double dt = dts[di];
+            for (long k = 0; k < steps; ++k)
+                inputs[ii].fn(k, dt, &u[2 * k], &u[2 * k + 1]);
+            long err_steps = (long)(200.0 / dt); // 200 s de trajetória para o erro
+            for (size_t gi = 0; gi < sizeof(integ) / sizeof(integ[0]); ++gi)
+            {
+                // RK45 com tolerância apertada é bem mais lento: menos passos para a vazão
+                long sp = integ[gi].id == SIM_RK45 ? steps / 10 : steps;
+                double rate = run_speed(integ[gi].id, u, dt, sp);
+                double err = run_error(integ[gi].id, inputs[ii].fn, dt, err_steps);
+                fprintf(fp, "%s,%s,%g,%.1f,%.3e\n", integ[gi].name, inputs[ii].name, dt, rate, err);
+                printf("%-6s %-4s %6g %14.0f %12.3e\n", integ[gi].name, inputs[ii].name, dt, rate, err);
+            }
+        }
+    }
+    free(u);
+    fclose(fp);
+    printf("OK: %s gerado.\n", out_path);
+    return 0;
+}
@@ -0,0 +1,126 @@
+// bench_handoff.c
+// Latência de ida-e-volta I/O -> simulação -> I/O pela API do sim_robot:
+// publish_input + wait_output sem dormir entre os passos. O mesmo fonte é
+// compilado contra as filas SPSC (padrão) e contra -DSIMROBOT_LEGACY_MAILBOX.
+//   $ make bench      (gera out/bench_handoff.csv com os dois esquemas)
+//   $ ./lab2_bench [saida.csv] [passos]
+#define _POSIX_C_SOURCE 200809L
+
+#include "sim_robot.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#ifdef SIMROBOT_LEGACY_MAILBOX
+#define SCHEME "mutex_cond"
+#else
+#define SCHEME "spsc"
+#endif
+
+#define PIPE_BATCH 32 // passos publicados antes de esperar as saídas (só SPSC)
+
+// Passo exato em binário: t acumulado pela simulação bate com t_end após
+// centenas de milhares de passos (com 0.05 a thread poderia parar 1 passo antes)
+#define BENCH_DT 0.0625
+
+static inline long long now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (long long)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+static int cmp_ll(const void *a, const void *b)
+{
+    long long x = *(const long long *)a, y = *(const long long *)b;
+    return (x > y) - (x < y);
+}
+
+static void start_sim(int steps)
+{
+    SimParams params = {.dt = BENCH_DT, .t_end = BENCH_DT * steps, .D = 0.30};
+    simrobot_init(&params);
+    if (simrobot_start() != 0)
+    {
+        perror("pthread_create(sim)");
+        exit(1);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    const char *out_path = (argc >= 2) ? argv[1] : "out/bench_handoff.csv";
+    int steps = (argc >= 3) ? atoi(argv[2]) : 200000;
+    if (steps < 100)
+        steps = 100;
+
+    long long *lat = malloc((size_t)steps * sizeof(long long));
+    if (!lat)
+    {
+        perror("malloc");
+        return 1;
+    }
+
+    // ====== 1) Ida-e-volta: 1 passo em voo ======
+    start_sim(steps);
+    double v, w, t_next, yx, yy, th;
+    for (int k = 0; k < steps; ++k)
+    {
+        simrobot_generate_u(BENCH_DT * k, &v, &w);
+        long long t0 = now_ns();
+        simrobot_publish_input(BENCH_DT * k, v, w, k);
+        simrobot_wait_output(k, &t_next, &yx, &yy, &th);
+        lat[k] = now_ns() - t0;
+    }
+    simrobot_join();
+
+    qsort(lat, (size_t)steps, sizeof(long long), cmp_ll);
+    double mean = 0.0;
+    for (int k = 0; k < steps; ++k)
+        mean += (double)lat[k];
+    mean /= steps;
+
+    // ====== 2) Vazão com passos em lote (filas permitem vários em voo) ======
+    double pipe_ns = -1.0;
+#ifndef SIMROBOT_LEGACY_MAILBOX
+    start_sim(steps);
+    long long t0 = now_ns();
+    for (int k = 0; k < steps; k += PIPE_BATCH)
+    {
+        int end = (k + PIPE_BATCH < steps) ? k + PIPE_BATCH : steps;
+        for (int j = k; j < end; ++j)
+        {
+            simrobot_generate_u(BENCH_DT * j, &v, &w);
+            simrobot_publish_input(BENCH_DT * j, v, w, j);
+        }
+        for (int j = k; j < end; ++j)
+            simrobot_wait_output(j, &t_next, &yx, &yy, &th);
+    }
+    pipe_ns = (double)(now_ns() - t0) / steps;
+    simrobot_join();
+#endif
+    simrobot_destroy();
+
+    // ====== Saída (anexa; cabeçalho só em arquivo novo) ======
+    FILE *fp = fopen(out_path, "a");
+    if (!fp)
+    {
+        perror(out_path);
+        return 1;
+    }
+    if (ftell(fp) == 0)
+        fprintf(fp, "scheme,steps,min_ns,p50_ns,p99_ns,max_ns,mean_ns,pipelined_ns_per_step\n");
+    fprintf(fp, "%s,%d,%lld,%lld,%lld,%lld,%.1f,%.1f\n", SCHEME, steps,
+            lat[0], lat[steps / 2], lat[(size_t)(0.99 * (steps - 1))], lat[steps - 1], mean, pipe_ns);
+    fclose(fp);
+
+    printf("%-10s ida-e-volta: p50 %lld ns | p99 %lld ns | max %lld ns", SCHEME,
+           lat[steps / 2], lat[(size_t)(0.99 * (steps - 1))], lat[steps - 1]);
+    if (pipe_ns > 0.0)
+        printf(" | em lote (%d): %.1f ns/passo", PIPE_BATCH, pipe_ns);
+    printf("\n");
+    free(lat);
+    return 0;
+}
@@ -0,0 +1,40 @@
+#ifndef FLEET_H
+#define FLEET_H
+
+#include <stddef.h>
+#include "sim_robot.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Configuração de uma rodada de frota (tempo lógico, sem dormir)
+typedef struct {
+    size_t    robots;   // nº de instâncias SimRobot
+    unsigned  workers;  // threads de trabalho (0 = CPUs online)
+    int       steps;    // passos por robô
+    int       pin;      // != 0: fixa o worker i na CPU i % ncpu
+    SimParams params;   // parâmetros comuns, inclusive o integrador (t_end é ignorado: vale 'steps')
+} FleetConfig;
+
+typedef struct {
+    unsigned workers;      // threads efetivamente usadas
+    unsigned pinned;       // quantas conseguiram afinidade
+    double   wall_s;       // tempo de parede da rodada
+    double   steps_per_s;  // robôs * passos / wall_s
+    double   checksum;     // soma de yx finais (sanidade; todos iguais com a mesma u)
+} FleetReport;
+
+/**
+ * Simula 'robots' robôs independentes com u(t) = simrobot_generate_u,
+ * repartidos em fatias contíguas entre os workers; cada worker avança seus
+ * robôs com sim_step (sem filas nem thread por robô).
+ * Retorna 0 em sucesso, -1 se faltar memória ou a configuração for inválida.
+ */
+int fleet_run(const FleetConfig *cfg, FleetReport *rep);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // FLEET_H
@@ -0,0 +1,52 @@
+#ifndef HDR_HIST_H
+#define HDR_HIST_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Histograma log-linear (estilo HDR) de inteiros >= 0 (ex.: ns). Valores
+ * abaixo de 2^HDR_SUB_BITS têm bucket exato; acima disso cada potência de 2
+ * é dividida em 2^(HDR_SUB_BITS-1) buckets, erro relativo <= 2^-(HDR_SUB_BITS-1)
+ * (~1.6% com 7 bits). Tamanho fixo, sem alocação: hdr_record é O(1) e pode
+ * ser chamado no laço de tempo real.
+ */
+#define HDR_SUB_BITS 7
+#define HDR_SUB      (1 << HDR_SUB_BITS)
+#define HDR_BUCKETS  (HDR_SUB + (63 - HDR_SUB_BITS) * (HDR_SUB / 2))
+
+typedef struct {
+    uint64_t counts[HDR_BUCKETS];
+    uint64_t total;
+    int64_t  min, max;
+    double   sum;
+} HdrHist;
+
+void    hdr_init(HdrHist *h);
+
+// Registra v (valores negativos contam como 0).
+void    hdr_record(HdrHist *h, int64_t v);
+
+// Limite superior do bucket que contém o percentil p (0..100); 0 se vazio.
+int64_t hdr_percentile(const HdrHist *h, double p);
+
+/**
+ * Uma linha de resumo: nome, contagem, min, p50, p99, p99.9, max e média,
+ * convertidos para 'unit' (ex.: 1e3 para µs a partir de ns).
+ */
+void    hdr_print_summary(const HdrHist *h, const char *name, double unit, FILE *fp);
+
+/**
+ * Buckets não vazios em CSV: name,lo,hi,count (hi exclusivo, na unidade registrada).
+ */
+void    hdr_print_buckets(const HdrHist *h, const char *name, FILE *fp);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HDR_HIST_H
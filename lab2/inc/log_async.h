@@ -0,0 +1,69 @@
+#ifndef LOG_ASYNC_H
+#define LOG_ASYNC_H
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "spsc.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Registro de tamanho fixo copiado pela thread periódica (sem formatação)
+typedef enum {
+    LOG_SAMPLE = 0,  // linha de sim_out.tsv: t, v, w, yx, yy
+    LOG_PERIOD       // linha de periods_*.csv: k, t_wall, T, J
+} LogKind;
+
+typedef struct {
+    int    kind;     // LogKind
+    int    k;        // índice (LOG_PERIOD)
+    double d[5];     // campos na ordem das colunas
+} LogRecord;
+
+/*
+ * Escritor assíncrono: a thread de tempo real só copia um LogRecord para uma
+ * fila SPSC pré-alocada (try_push: nunca bloqueia nem faz syscall). Uma
+ * thread de baixa prioridade (SCHED_IDLE quando disponível) esvazia a fila a
+ * cada LOG_ASYNC_POLL_MS, formata e grava nos arquivos.
+ */
+#define LOG_ASYNC_POLL_MS 5
+
+typedef struct {
+    SpscRing       ring;
+    LogRecord     *storage;
+    FILE          *fp_sample;  // destino de LOG_SAMPLE (pode ser NULL)
+    FILE          *fp_period;  // destino de LOG_PERIOD (pode ser NULL)
+    pthread_t      thread;
+    atomic_int     running;
+    unsigned long  dropped;    // registros perdidos com a fila cheia (só o produtor escreve)
+    int            idle_prio;  // 1 se o escritor conseguiu SCHED_IDLE
+} LogAsync;
+
+/**
+ * Aloca a fila ('capacity' potência de 2) e inicia o escritor.
+ * Os arquivos continuam do chamador (cabeçalhos podem ser gravados antes).
+ * Retorna 0 em sucesso, -1 em erro (memória, capacidade ou thread).
+ */
+int  log_async_start(LogAsync *L, FILE *fp_sample, FILE *fp_period, size_t capacity);
+
+/**
+ * Enfileira um registro. Retorna false (e conta em 'dropped') se a fila
+ * estiver cheia. Só pode ser chamada por uma thread (produtor único).
+ */
+bool log_async_push(LogAsync *L, const LogRecord *rec);
+
+/**
+ * Para o escritor depois de gravar tudo o que está na fila e libera a fila.
+ * Não fecha os arquivos.
+ */
+void log_async_stop(LogAsync *L);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // LOG_ASYNC_H
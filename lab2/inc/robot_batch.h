@@ -0,0 +1,49 @@
+#ifndef ROBOT_BATCH_H
+#define ROBOT_BATCH_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Frota em estrutura-de-arrays: o elemento i de cada vetor é o robô i.
+// Vetores alinhados a 64 bytes para carregar 4 (AVX2) ou 8 (AVX-512) robôs
+// por instrução.
+typedef struct {
+    size_t  n;
+    double *x, *y, *theta;  // estado
+    double *v, *w;          // entrada constante no passo
+} RobotBatch;
+
+/**
+ * Aloca os 5 vetores (zerados). Retorna 0 em sucesso, -1 sem memória.
+ */
+int  robot_batch_init(RobotBatch *B, size_t n);
+void robot_batch_free(RobotBatch *B);
+
+/**
+ * Um passo RK4 para todos os robôs (mesma dinâmica de sim_robot.c). Com w
+ * constante no passo os estágios 2 e 3 têm o mesmo theta, então são 3
+ * sincos por robô, calculados por polinômio sem chamadas de libm: o laço
+ * é vetorizado pelo compilador.
+ */
+void robot_batch_rk4(RobotBatch *B, double dt);
+
+/**
+ * Ponto frontal de todos os robôs: yx[i], yy[i] (mesma fórmula de front_point).
+ */
+void robot_batch_front(const RobotBatch *B, double D, double *yx, double *yy);
+
+/**
+ * sin e cos por redução de Cody-Waite (pi/2 em 3 partes) e polinômios do
+ * fdlibm em [-pi/4, pi/4]. Erro ~1 ulp para |x| < 1e5. Sem desvios: usável
+ * dentro de laços vetorizados.
+ */
+void robot_batch_sincos(double x, double *s, double *c);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ROBOT_BATCH_H
@@ -0,0 +1,75 @@
+#ifndef RT_PROFILE_H
+#define RT_PROFILE_H
+
+#include <pthread.h>
+#include <stddef.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Threads configuráveis
+typedef enum {
+    RT_IO = 0,   // thread periódica de I/O
+    RT_SIM,      // thread de simulação
+    RT_LOAD,     // thread de carga (--load)
+    RT_NROLES
+} RtRole;
+
+#define RT_CPU_NONE (-1)  // sem afinidade
+#define RT_CPU_LAST (-2)  // última CPU online
+
+/*
+ * Perfil de tempo real: prioridade SCHED_FIFO por thread (0 = mantém
+ * SCHED_OTHER), CPU de cada thread, mlockall e pré-falta de pilha/heap.
+ * Tudo é "melhor esforço": o que falhar (ex.: EPERM sem CAP_SYS_NICE) fica
+ * registrado no RtReport e a execução segue com o padrão.
+ */
+typedef struct {
+    const char *name;
+    const char *desc;
+    int    fifo_prio[RT_NROLES];
+    int    cpu[RT_NROLES];     // índice de CPU, RT_CPU_NONE ou RT_CPU_LAST
+    int    mlock;              // mlockall(MCL_CURRENT | MCL_FUTURE)
+    size_t prefault_stack;     // bytes de pilha tocados pela thread de I/O
+    size_t prefault_heap;      // bytes de heap tocados e mantidos no processo
+} RtProfile;
+
+// O que de fato entrou em vigor (0 = não pedido, 1 = ok, -errno = falhou)
+typedef struct {
+    int    fifo[RT_NROLES];
+    int    cpu[RT_NROLES];
+    int    cpu_used[RT_NROLES];
+    int    mlock;
+    size_t stack_touched;
+    size_t heap_touched;
+} RtReport;
+
+// Perfil pelo nome (NULL se não existir) e lista dos perfis disponíveis.
+const RtProfile *rt_profile_find(const char *name);
+void rt_profile_list(FILE *fp);
+
+/**
+ * Configurações do processo: mlockall e pré-falta do heap. Chamar antes de
+ * criar as threads (com MCL_FUTURE as pilhas novas já nascem travadas).
+ */
+void rt_apply_process(const RtProfile *P, RtReport *rep);
+
+// Política/prioridade e afinidade da thread 'th' no papel 'role'.
+void rt_apply_thread(pthread_t th, RtRole role, const RtProfile *P, RtReport *rep);
+
+// Só a política/prioridade (quando a afinidade é decidida por outro módulo).
+void rt_apply_prio(pthread_t th, RtRole role, const RtProfile *P, RtReport *rep);
+
+// Pré-falta 'bytes' da pilha da thread chamadora.
+void rt_prefault_stack(size_t bytes, RtReport *rep);
+
+// Relatório legível do que foi pedido e do que entrou em vigor.
+void rt_report_print(const RtProfile *P, const RtReport *rep, FILE *fp);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RT_PROFILE_H
@@ -1,17 +1,91 @@
 #ifndef SIM_ROBOT_H
 #define SIM_ROBOT_H
 
+#include <pthread.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+// Passos que podem estar em voo entre I/O e simulação (filas SPSC; potência de 2).
+// Compilando com -DSIMROBOT_LEGACY_MAILBOX volta ao esquema mutex/condvar de caixa única.
+#ifndef SIMROBOT_RING_CAP
+#define SIMROBOT_RING_CAP 64
+#endif
+
+// Integrador usado em cada período [t_k, t_{k+1})
+typedef enum {
+    SIM_RK4 = 0,   // um passo RK4 fixo de dt (padrão)
+    SIM_RK45,      // Dormand-Prince 5(4) com passo adaptativo (rtol/atol)
+    SIM_EXACT      // solução fechada do uniciclo com u constante (1 sincos por passo)
+} SimIntegrator;
+
 // Parâmetros do simulador
 typedef struct {
     double dt;     // Passo (s) — aqui: 0.05
     double t_end;  // Tempo final (s) — aqui: 20.0
     double D;      // Diâmetro do robô (m) — aqui: 0.30
+    SimIntegrator integrator; // SIM_RK4 se omitido
+    double rtol;   // SIM_RK45: tolerância relativa (<= 0: 1e-6)
+    double atol;   // SIM_RK45: tolerância absoluta (<= 0: 1e-9)
 } SimParams;
 
+// Contadores do integrador
+typedef struct {
+    unsigned long periods;   // períodos dt simulados
+    unsigned long accepted;  // passos internos aceitos
+    unsigned long rejected;  // passos rejeitados pelo controle de erro
+    unsigned long f_evals;   // avaliações de f_dyn
+} SimStats;
+
+// ----------------- API por instância -----------------
+// Cada SimRobot tem seu próprio estado, filas e thread de simulação: vários
+// robôs podem ser simulados no mesmo processo.
+typedef struct SimRobot SimRobot;
+
+/**
+ * Cria um robô com parâmetros (NULL = dt 0.05, t_end 20, D 0.30) e x(0)=0.
+ * Retorna NULL se a alocação falhar.
+ */
+SimRobot *sim_create(const SimParams *params);
+
+/**
+ * Aguarda a thread (se iniciada), libera o robô e zera o ponteiro.
+ */
+void sim_destroy(SimRobot **R);
+
+/**
+ * Inicia/aguarda a thread de simulação da instância (0 em sucesso).
+ */
+int  sim_start(SimRobot *R);
+void sim_join(SimRobot *R);
+
+/**
+ * Equivalentes por instância de simrobot_publish_input / simrobot_wait_output.
+ */
+void sim_publish_input(SimRobot *R, double t_k, double v, double w, int seq);
+void sim_wait_output(SimRobot *R, int expected_seq, double *t_next, double *yx, double *yy, double *theta);
+
+/**
+ * Handle da thread de simulação (para prioridade/afinidade).
+ * Retorna 0 se a thread estiver iniciada, -1 caso contrário.
+ */
+int  sim_get_thread(const SimRobot *R, pthread_t *th);
+
+/**
+ * Lê os contadores do integrador da instância (use após sim_join).
+ */
+void sim_get_stats(const SimRobot *R, SimStats *stats);
+
+/**
+ * Avança um passo de forma síncrona na thread chamadora (sem filas), com u
+ * constante em [t_k, t_k+dt). Para runners que simulam muitos robôs por
+ * thread; não misturar com sim_start na mesma instância.
+ */
+void sim_step(SimRobot *R, double v, double w, double *t_next, double *yx, double *yy, double *theta);
+
+// ----------------- API global (instância padrão) -----------------
+
 /**
  * Inicializa o módulo com parâmetros (dt, t_end, D).
  * Deve ser chamado antes de iniciar a simulação.
@@ -19,7 +93,7 @@ typedef struct {
 void simrobot_init(const SimParams *params);
 
 /**
- * Encerra o módulo (destroy de mutex/conds). Opcional.
+ * Encerra a instância padrão (destroy de mutex/conds). Opcional.
  */
 void simrobot_destroy(void);
 
@@ -37,16 +111,29 @@ void simrobot_join(void);
 /**
  * Publica a entrada u_k = [v, w] válida no intervalo [t_k, t_k+dt), com rótulo de sequência 'seq'.
  * Esta é a ÚNICA forma de comunicação de I/O -> Simulação.
+ * As entradas são enfileiradas em ordem: é possível publicar vários passos
+ * antes de esperar as saídas (bloqueia só com SIMROBOT_RING_CAP pendentes).
  */
 void simrobot_publish_input(double t_k, double v, double w, int seq);
 
 /**
- * Aguarda a saída y_{k+1} rotulada com 'expected_seq' e a retorna.
+ * Aguarda a saída y_{k+1} rotulada com 'expected_seq' e a retorna
+ * (saídas com seq anterior ainda na fila são descartadas).
  * Saída: t_{k+1}, yx, yy, theta (theta é opcional/para depuração).
  * Esta é a ÚNICA forma de comunicação de Simulação -> I/O.
  */
 void simrobot_wait_output(int expected_seq, double *t_next, double *yx, double *yy, double *theta);
 
+/**
+ * Handle da thread de simulação da instância padrão (0 se iniciada).
+ */
+int  simrobot_get_thread(pthread_t *th);
+
+/**
+ * Contadores do integrador da instância padrão (use após simrobot_join).
+ */
+void simrobot_get_stats(SimStats *stats);
+
 /**
  * (Helper opcional) Gera u(t) segundo a lei por trechos do laboratório:
  *  t < 0: v=0, w=0
@@ -0,0 +1,71 @@
+#ifndef SPSC_H
+#define SPSC_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SPSC_CACHE_LINE 64
+
+/*
+ * Fila circular lock-free de 1 produtor / 1 consumidor com elementos de
+ * tamanho fixo. Os índices de cada lado ficam em linhas de cache separadas
+ * (sem false sharing). No caminho normal push/pop são um memcpy, um store
+ * com release, uma cerca seq_cst (mfence no x86) e a leitura relaxed do flag
+ * de espera do outro lado. O incremento atômico da palavra do futex e a
+ * syscall só acontecem quando o outro lado anunciou que vai dormir (fila
+ * vazia para o consumidor, cheia para o produtor).
+ *
+ * O armazenamento é fornecido pelo chamador (capacity * elem_size bytes),
+ * então nenhuma função aloca memória.
+ */
+typedef struct {
+    // Lado do produtor
+    _Alignas(SPSC_CACHE_LINE) _Atomic size_t tail;   // próxima posição a escrever
+    _Atomic uint32_t pushes;                         // palavra de futex: muda a cada wake do consumidor
+    size_t cached_head;                              // cópia local de head
+
+    // Lado do consumidor
+    _Alignas(SPSC_CACHE_LINE) _Atomic size_t head;   // próxima posição a ler
+    _Atomic uint32_t pops;                           // palavra de futex: muda a cada wake do produtor
+    size_t cached_tail;                              // cópia local de tail
+
+    // Flags de espera: lidos pelo outro lado a cada push/pop e escritos só no
+    // caminho lento, então a linha fica compartilhada (só leitura) nos dois
+    // caches em vez de puxar a linha de head/tail a cada elemento
+    _Alignas(SPSC_CACHE_LINE) _Atomic uint32_t prod_waiting; // produtor dormindo (fila cheia)
+    _Atomic uint32_t cons_waiting;                   // consumidor dormindo (fila vazia)
+
+    // Somente leitura após spsc_init
+    _Alignas(SPSC_CACHE_LINE) unsigned char *buf;
+    size_t elem_size;
+    size_t mask;                                     // capacity - 1
+} SpscRing;
+
+/**
+ * Inicializa a fila sobre 'storage'. 'capacity' deve ser potência de 2 (>= 2).
+ * Retorna 0 em sucesso, -1 se os argumentos forem inválidos.
+ */
+int  spsc_init(SpscRing *r, void *storage, size_t elem_size, size_t capacity);
+
+// Não bloqueantes: retornam false se a fila estiver cheia/vazia.
+bool spsc_try_push(SpscRing *r, const void *elem);
+bool spsc_try_pop (SpscRing *r, void *elem);
+
+// Bloqueantes: dormem no futex enquanto a fila estiver cheia/vazia.
+void spsc_push(SpscRing *r, const void *elem);
+void spsc_pop (SpscRing *r, void *elem);
+
+// Nº de elementos na fila (aproximado se chamado fora do produtor/consumidor).
+size_t spsc_size(const SpscRing *r);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SPSC_H
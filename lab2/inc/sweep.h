@@ -0,0 +1,72 @@
+#ifndef SWEEP_H
+#define SWEEP_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "sim_robot.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Varredura de parâmetros + Monte Carlo em tempo lógico. A grade é o produto
+ * dt x D x t_end x gain_sigma x noise_sigma; cada ponto (configuração) roda
+ * uma trajetória nominal (u = simrobot_generate_u) e 'replicates' trajetórias
+ * com entrada perturbada:
+ *   v' = v (1 + g_v) + n_v(k),   w' = w (1 + g_w) + n_w(k)
+ * g ~ N(0, gain_sigma) sorteado por execução e n ~ N(0, noise_sigma) por
+ * passo (m/s e rad/s). As sementes dependem só de (seed, configuração,
+ * réplica), então o resultado não depende do nº de workers.
+ */
+typedef struct {
+    const double *dt;          size_t n_dt;
+    const double *D;           size_t n_D;
+    const double *t_end;       size_t n_t_end;
+    const double *gain_sigma;  size_t n_gain;
+    const double *noise_sigma; size_t n_noise;
+    int           replicates;  // execuções perturbadas por configuração (>= 1)
+    unsigned      workers;     // 0 = CPUs online
+    uint64_t      seed;
+    SimIntegrator integrator;
+    double        rtol, atol;  // só para SIM_RK45 (0 = padrão)
+} SweepConfig;
+
+// Agregado por configuração (pose final = ponto frontal y e theta)
+typedef struct {
+    double dt, D, t_end, gain_sigma, noise_sigma;
+    int    runs;
+    long   steps;               // passos por execução
+    double yx_nom, yy_nom;      // pose final nominal
+    double yx_mean, yx_std, yy_mean, yy_std, theta_mean, theta_std;
+    double err_rms_mean, err_rms_max;     // RMS de |y - y_nom| ao longo da trajetória
+    double err_final_mean, err_final_max; // |y - y_nom| no instante final
+} SweepResult;
+
+typedef struct {
+    size_t        configs;
+    size_t        runs;         // execuções (nominais + perturbadas)
+    double        total_steps;
+    unsigned      workers;
+    unsigned long steals;
+    double        wall_s;
+} SweepReport;
+
+// Nº de configurações da grade (tamanho do vetor de resultados).
+size_t sweep_count(const SweepConfig *cfg);
+
+/**
+ * Roda a grade inteira num pool com roubo de trabalho e preenche
+ * out[0..sweep_count-1] (ordem: dt, D, t_end, gain, noise; o último varia
+ * mais rápido). Retorna 0, ou -1 se a grade for inválida ou faltar memória.
+ */
+int sweep_run(const SweepConfig *cfg, SweepResult *out, SweepReport *rep);
+
+// CSV compacto: cabeçalho + uma linha por configuração.
+int sweep_write_csv(const char *path, const SweepResult *res, size_t n);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SWEEP_H
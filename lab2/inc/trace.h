@@ -0,0 +1,89 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Traços de entrada gravados em campo: um registro (t, v, w) por período.
+ *  - Binário "SRTR": cabeçalho de 32 bytes + registros de 3 doubles (ordem
+ *    de bytes nativa). O arquivo é mapeado com mmap e lido direto, sem cópia
+ *    nem conversão.
+ *  - TSV: as 3 primeiras colunas de cada linha numérica (cabeçalhos e
+ *    linhas com '#' são ignorados). O arquivo é lido em blocos de
+ *    TRACE_TSV_BUF e convertido inteiro para a memória em trace_open.
+ * Nos dois casos trace_next só avança um índice: nenhuma leitura de arquivo
+ * nem conversão de texto acontece depois da abertura.
+ */
+#define TRACE_MAGIC    "SRTR"
+#define TRACE_VERSION  1u
+#define TRACE_TSV_BUF  (4u << 20)  // 4 MiB
+
+typedef struct {
+    char     magic[4];   // "SRTR"
+    uint32_t version;    // TRACE_VERSION
+    uint64_t count;      // nº de registros
+    double   dt;         // espaçamento de t (0 se irregular)
+    uint64_t reserved;
+} TraceHeader;
+
+typedef struct {
+    double t, v, w;
+} TraceRecord;
+
+typedef struct {
+    // Registros: o arquivo mapeado (binário) ou o vetor convertido (TSV)
+    const TraceRecord *rec;
+    size_t             n, pos;
+    size_t             count;     // registros no arquivo
+    double             dt;        // espaçamento declarado/medido (0 se irregular)
+
+    // Binário mapeado
+    void  *map;
+    size_t map_len;
+
+    // TSV convertido (o buffer de leitura só existe durante trace_open)
+    int          fd;
+    char        *buf;
+    size_t       buf_len, buf_pos;
+    int          eof;
+    int          skip;      // descartando o resto de uma linha maior que o buffer
+    int          read_err;  // errno de um read que falhou (0 = fim normal)
+    TraceRecord *recs;
+} Trace;
+
+/**
+ * Abre um traço binário (pelo magic) ou TSV. O TSV é convertido numa única
+ * passada, que também mede dt. Retorna 0, ou -1 com a causa em stderr.
+ */
+int  trace_open(Trace *T, const char *path);
+void trace_close(Trace *T);
+
+// Volta ao primeiro registro (para --runs).
+int  trace_rewind(Trace *T);
+
+// Próximo registro (1) ou fim do traço (0).
+static inline int trace_next(Trace *T, double *t, double *v, double *w) {
+    if (T->pos == T->n) return 0;
+    const TraceRecord *r = &T->rec[T->pos++];
+    *t = r->t;
+    *v = r->v;
+    *w = r->w;
+    return 1;
+}
+
+/**
+ * Converte um TSV em traço binário. dt é medido dos registros (0 se o
+ * espaçamento não for uniforme). Retorna 0, ou -1 com a causa em stderr.
+ */
+int trace_convert_tsv(const char *tsv_path, const char *bin_path, size_t *count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TRACE_H
@@ -0,0 +1,64 @@
+#ifndef WAKEUP_H
+#define WAKEUP_H
+
+#include <stdbool.h>
+
+#include "hdr_hist.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Estratégias para acordar no instante absoluto do próximo período:
+ *  - WAKE_SLEEP : só clock_nanosleep (latência do timer + escalonador)
+ *  - WAKE_HYBRID: dorme até alvo - margem e gira em CLOCK_MONOTONIC (com
+ *                 instrução de pausa) até o alvo
+ *  - WAKE_SPIN  : gira o período inteiro (referência de custo de CPU)
+ * Com margem automática, a margem acompanha o pico recente do atraso do
+ * sono (com decaimento) mais uma folga, limitada a WAKE_MARGIN_MAX_NS.
+ */
+typedef enum {
+    WAKE_SLEEP = 0,
+    WAKE_HYBRID,
+    WAKE_SPIN
+} WakeMode;
+
+#define WAKE_MARGIN_PAD_NS  5000LL    // folga somada ao pico observado
+#define WAKE_MARGIN_MAX_NS  2000000LL // teto da margem automática (2 ms)
+
+typedef struct {
+    WakeMode      mode;
+    bool          auto_margin;
+    long long     margin_ns;  // margem atual (WAKE_HYBRID)
+    long long     peak_ns;    // pico do atraso do sono, com decaimento
+    unsigned long wakeups;
+    unsigned long late;       // o sono passou do alvo (margem insuficiente)
+    long long     spin_ns;    // tempo total girando
+    HdrHist       overshoot;  // atraso do clock_nanosleep em relação ao pedido (ns)
+} Wakeup;
+
+// "sleep" | "hybrid" | "spin"; retorna 0 ou -1 se o nome for desconhecido.
+int         wakeup_parse(const char *name, WakeMode *mode);
+const char *wakeup_name(WakeMode mode);
+
+// margin_ns < 0 liga a margem automática (começa em WAKE_MARGIN_PAD_NS).
+void wakeup_init(Wakeup *W, WakeMode mode, long long margin_ns);
+
+/**
+ * Mede o atraso de 'samples' sonos curtos (1 ms) para semear a margem
+ * automática antes do laço periódico. Não faz nada com margem fixa.
+ */
+void wakeup_calibrate(Wakeup *W, int samples);
+
+/**
+ * Espera até target_ns (CLOCK_MONOTONIC) com a estratégia de W; sinais
+ * (EINTR) não encurtam a espera. Retorna o instante lido ao sair.
+ */
+long long wakeup_until(Wakeup *W, long long target_ns);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // WAKEUP_H
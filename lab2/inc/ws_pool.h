@@ -0,0 +1,36 @@
+#ifndef WS_POOL_H
+#define WS_POOL_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Pool fork-join com roubo de trabalho para tarefas independentes 0..n-1.
+ * Cada worker começa com uma faixa contígua [lo, hi) das tarefas e consome
+ * pela frente; quem esvazia rouba a metade de trás da faixa de outro worker
+ * (um CAS sobre lo|hi empacotados em 64 bits). Tarefas de custo desigual
+ * (ex.: simulações com dt/t_end diferentes) se equilibram sozinhas.
+ */
+typedef void (*WsTaskFn)(size_t task, unsigned worker, void *ctx);
+
+typedef struct {
+    unsigned      workers;  // threads usadas (a chamadora é o worker 0)
+    unsigned long steals;   // roubos bem-sucedidos
+    double        wall_s;
+} WsPoolStats;
+
+/**
+ * Executa fn(task, worker, ctx) para task = 0..n_tasks-1 e só retorna quando
+ * todas terminaram. workers = 0 usa as CPUs online. Retorna 0, ou -1 se
+ * n_tasks não couber em 32 bits ou faltar memória.
+ */
+int ws_pool_run(size_t n_tasks, unsigned workers, WsTaskFn fn, void *ctx, WsPoolStats *st);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // WS_POOL_H
@@ -0,0 +1,119 @@
+// fleet.c
+// Runner de frota: muitos SimRobot avançados em tempo lógico por workers fixos.
+
+// --- Feature test macros ---
+#define _GNU_SOURCE // pthread_setaffinity_np, CPU_SET
+
+#include "fleet.h"
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+#define FLEET_MAX_WORKERS 256
+
+typedef struct {
+    SimRobot **robots;
+    size_t     lo, hi;    // fatia [lo, hi)
+    int        steps;
+    double     sum_yx;    // saída do worker
+} FleetWork;
+
+static inline long long now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (long long)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+static void *fleet_worker_fn(void *arg) {
+    FleetWork *W = (FleetWork *)arg;
+    double sum = 0.0;
+    for (size_t r = W->lo; r < W->hi; ++r) {
+        double t_k = 0.0, t_next = 0.0, yx = 0.0, yy, theta, v, w;
+        for (int k = 0; k < W->steps; ++k) {
+            simrobot_generate_u(t_k, &v, &w);
+            sim_step(W->robots[r], v, w, &t_next, &yx, &yy, &theta);
+            t_k = t_next;
+        }
+        sum += yx;
+    }
+    W->sum_yx = sum;
+    return NULL;
+}
+
+static int pin_to_cpu(pthread_t th, unsigned cpu) {
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return pthread_setaffinity_np(th, sizeof(set), &set) == 0;
+#else
+    (void)th; (void)cpu;
+    return 0;
+#endif
+}
+
+int fleet_run(const FleetConfig *cfg, FleetReport *rep) {
+    if (!cfg || !rep || cfg->robots == 0 || cfg->steps <= 0) return -1;
+
+    long ncpu = sysconf(_SC_NPROCESSORS_ONLN);
+    if (ncpu < 1) ncpu = 1;
+    unsigned nw = cfg->workers ? cfg->workers : (unsigned)ncpu;
+    if (nw > FLEET_MAX_WORKERS) nw = FLEET_MAX_WORKERS;
+    if (nw > cfg->robots) nw = (unsigned)cfg->robots;
+
+    SimRobot **robots = (SimRobot **)calloc(cfg->robots, sizeof(SimRobot *));
+    if (!robots) return -1;
+    int rc = 0;
+    for (size_t r = 0; r < cfg->robots; ++r) {
+        robots[r] = sim_create(&cfg->params);
+        if (!robots[r]) { rc = -1; break; }
+    }
+
+    FleetWork work[FLEET_MAX_WORKERS];
+    pthread_t th[FLEET_MAX_WORKERS];
+    int created[FLEET_MAX_WORKERS] = {0};
+    unsigned pinned = 0;
+    long long t0 = now_ns();
+
+    if (rc == 0) {
+        for (unsigned i = 0; i < nw; ++i) {
+            work[i] = (FleetWork){ .robots = robots,
+                                   .lo = cfg->robots * i / nw,
+                                   .hi = cfg->robots * (i + 1) / nw,
+                                   .steps = cfg->steps };
+            // O worker 0 é a própria thread chamadora
+            if (i == 0) continue;
+            created[i] = (pthread_create(&th[i], NULL, fleet_worker_fn, &work[i]) == 0);
+            if (created[i] && cfg->pin) pinned += (unsigned)pin_to_cpu(th[i], i % (unsigned)ncpu);
+        }
+#ifdef __linux__
+        // A chamadora vira o worker 0: guarda a afinidade original para restaurar
+        cpu_set_t orig;
+        int have_orig = cfg->pin && pthread_getaffinity_np(pthread_self(), sizeof(orig), &orig) == 0;
+#endif
+        if (cfg->pin) pinned += (unsigned)pin_to_cpu(pthread_self(), 0);
+        fleet_worker_fn(&work[0]);
+#ifdef __linux__
+        if (have_orig) pthread_setaffinity_np(pthread_self(), sizeof(orig), &orig);
+#endif
+
+        double sum = work[0].sum_yx;
+        for (unsigned i = 1; i < nw; ++i) {
+            if (!created[i]) fleet_worker_fn(&work[i]); // falhou a criação: faz aqui
+            else pthread_join(th[i], NULL);
+            sum += work[i].sum_yx;
+        }
+        rep->wall_s = (now_ns() - t0) / 1e9;
+        rep->workers = nw;
+        rep->pinned = pinned;
+        rep->steps_per_s = (double)cfg->robots * cfg->steps / rep->wall_s;
+        rep->checksum = sum;
+    }
+
+    for (size_t r = 0; r < cfg->robots; ++r) sim_destroy(&robots[r]);
+    free(robots);
+    return rc;
+}
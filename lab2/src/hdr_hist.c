@@ -0,0 +1,77 @@
+// hdr_hist.c
+// Histograma log-linear de tamanho fixo para latências.
+
+#include "hdr_hist.h"
+
+#include <string.h>
+
+static inline int bucket_of(uint64_t v) {
+    if (v < HDR_SUB) return (int)v;
+    int e = 63 - __builtin_clzll(v);       // floor(log2 v) >= HDR_SUB_BITS
+    int shift = e - HDR_SUB_BITS + 1;      // >= 1
+    int top = (int)(v >> shift);           // em [HDR_SUB/2, HDR_SUB)
+    return HDR_SUB + (shift - 1) * (HDR_SUB / 2) + (top - HDR_SUB / 2);
+}
+
+// Limites [lo, hi) do bucket i
+static inline void bucket_range(int i, uint64_t *lo, uint64_t *hi) {
+    if (i < HDR_SUB) { *lo = (uint64_t)i; *hi = (uint64_t)i + 1; return; }
+    int shift = (i - HDR_SUB) / (HDR_SUB / 2) + 1;
+    uint64_t top = (uint64_t)((i - HDR_SUB) % (HDR_SUB / 2) + HDR_SUB / 2);
+    *lo = top << shift;
+    *hi = (top + 1) << shift;
+}
+
+void hdr_init(HdrHist *h) {
+    memset(h, 0, sizeof(*h));
+    h->min = INT64_MAX;
+    h->max = 0;
+}
+
+void hdr_record(HdrHist *h, int64_t v) {
+    if (v < 0) v = 0;
+    h->counts[bucket_of((uint64_t)v)]++;
+    h->total++;
+    h->sum += (double)v;
+    if (v < h->min) h->min = v;
+    if (v > h->max) h->max = v;
+}
+
+int64_t hdr_percentile(const HdrHist *h, double p) {
+    if (h->total == 0) return 0;
+    if (p >= 100.0) return h->max;
+    uint64_t rank = (uint64_t)(p / 100.0 * (double)h->total);
+    if (rank >= h->total) rank = h->total - 1;
+    uint64_t acc = 0;
+    for (int i = 0; i < HDR_BUCKETS; ++i) {
+        acc += h->counts[i];
+        if (acc > rank) {
+            uint64_t lo, hi;
+            bucket_range(i, &lo, &hi);
+            int64_t up = (int64_t)(hi - 1);
+            return (up > h->max) ? h->max : up; // nunca acima do máximo observado
+        }
+    }
+    return h->max;
+}
+
+void hdr_print_summary(const HdrHist *h, const char *name, double unit, FILE *fp) {
+    if (h->total == 0) {
+        fprintf(fp, "%-10s n=0\n", name);
+        return;
+    }
+    fprintf(fp, "%-10s n=%-8llu min=%-10.3f p50=%-10.3f p99=%-10.3f p99.9=%-10.3f max=%-10.3f média=%.3f\n",
+            name, (unsigned long long)h->total, h->min / unit,
+            hdr_percentile(h, 50.0) / unit, hdr_percentile(h, 99.0) / unit,
+            hdr_percentile(h, 99.9) / unit, h->max / unit, h->sum / (double)h->total / unit);
+}
+
+void hdr_print_buckets(const HdrHist *h, const char *name, FILE *fp) {
+    for (int i = 0; i < HDR_BUCKETS; ++i) {
+        if (h->counts[i] == 0) continue;
+        uint64_t lo, hi;
+        bucket_range(i, &lo, &hi);
+        fprintf(fp, "%s,%llu,%llu,%llu\n", name, (unsigned long long)lo,
+                (unsigned long long)hi, (unsigned long long)h->counts[i]);
+    }
+}
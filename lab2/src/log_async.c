@@ -0,0 +1,76 @@
+// log_async.c
+// Escritor de log em segundo plano alimentado por uma fila SPSC.
+
+// --- Feature test macros ---
+#define _GNU_SOURCE // SCHED_IDLE
+
+#include "log_async.h"
+
+#include <sched.h>
+#include <stdlib.h>
+#include <time.h>
+
+static void write_record(LogAsync *L, const LogRecord *r) {
+    if (r->kind == LOG_SAMPLE && L->fp_sample) {
+        fprintf(L->fp_sample, "%.6f\t%.6f\t%.6f\t%.6f\t%.6f\n",
+                r->d[0], r->d[1], r->d[2], r->d[3], r->d[4]);
+    } else if (r->kind == LOG_PERIOD && L->fp_period) {
+        fprintf(L->fp_period, "%d,%.9f,%.9f,%.9f\n", r->k, r->d[0], r->d[1], r->d[2]);
+    }
+}
+
+static void *writer_thread_fn(void *arg) {
+    LogAsync *L = (LogAsync *)arg;
+    const struct timespec poll = {0, LOG_ASYNC_POLL_MS * 1000000L};
+    LogRecord rec;
+
+    for (;;) {
+        // Lê 'running' antes de esvaziar: o que foi enfileirado antes do stop é gravado
+        int keep = atomic_load(&L->running);
+        while (spsc_try_pop(&L->ring, &rec)) write_record(L, &rec);
+        if (!keep) break;
+        nanosleep(&poll, NULL);
+    }
+    return NULL;
+}
+
+int log_async_start(LogAsync *L, FILE *fp_sample, FILE *fp_period, size_t capacity) {
+    L->storage = (LogRecord *)malloc(capacity * sizeof(LogRecord));
+    if (!L->storage) return -1;
+    if (spsc_init(&L->ring, L->storage, sizeof(LogRecord), capacity) != 0) {
+        free(L->storage);
+        L->storage = NULL;
+        return -1;
+    }
+    L->fp_sample = fp_sample;
+    L->fp_period = fp_period;
+    L->dropped = 0;
+    L->idle_prio = 0;
+    atomic_store(&L->running, 1);
+
+    if (pthread_create(&L->thread, NULL, writer_thread_fn, L) != 0) {
+        free(L->storage);
+        L->storage = NULL;
+        return -1;
+    }
+#ifdef SCHED_IDLE
+    // Prioridade mínima: só roda quando a CPU estaria ociosa
+    struct sched_param sp = {.sched_priority = 0};
+    L->idle_prio = (pthread_setschedparam(L->thread, SCHED_IDLE, &sp) == 0);
+#endif
+    return 0;
+}
+
+bool log_async_push(LogAsync *L, const LogRecord *rec) {
+    if (spsc_try_push(&L->ring, rec)) return true;
+    L->dropped++;
+    return false;
+}
+
+void log_async_stop(LogAsync *L) {
+    if (!L->storage) return;
+    atomic_store(&L->running, 0);
+    pthread_join(L->thread, NULL);
+    free(L->storage);
+    L->storage = NULL;
+}
@@ -4,18 +4,34 @@
 #define _POSIX_C_SOURCE 200809L
 
 #include "sim_robot.h"
+#include "fleet.h"
+#include "sweep.h"
+#include "log_async.h"
+#include "hdr_hist.h"
+#include "rt_profile.h"
+#include "wakeup.h"
+#include "stress.h"
+#include "trace.h"
 
+#include <math.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <time.h>
 #include <pthread.h>
 #include <string.h>
 #include <stdbool.h>
+#include <errno.h>
+#include <signal.h>
 
 // ====== Parâmetros do laboratório (mesmos usados em sim_robot_init) ======
 static const double DT_IDEAL = 0.05; // 50 ms
 static const double T_END = 20.0;    // 20 s
 
+// Registros na fila do log assíncrono (até 2 por passo). A escritora esvazia a
+// fila a cada 5 ms, então 2048 dão ~51 s de folga a 50 ms por período; com
+// --trace a execução pode ser bem mais longa e a fila não a cobre inteira
+#define LOG_QUEUE_CAP 2048
+
 // ====== Helpers de tempo (CLOCK_MONOTONIC) ======
 static inline long long ns_from_ts(struct timespec ts)
 {
@@ -35,32 +51,101 @@ static inline long long now_ns(void)
     return ns_from_ts(ts);
 }
 
-// ====== Carga opcional (para “rodada com carga”) =========================
-// Uma thread de “carga” que consome CPU continuamente (sem comunicar nada).
-// Ela cria pressão de CPU para observar jitter.
-static volatile int g_run_load = 0;
+// ====== Histogramas de período, jitter e handoff (ns) =====================
+typedef struct
+{
+    HdrHist period;  // T(k) entre wake-ups
+    HdrHist jitter;  // |J(k)|
+    HdrHist handoff; // publish_input -> wait_output
+} HistSet;
+
+static HistSet g_hist;
+
+// SIGUSR1 pede um dump dos histogramas; feito pela thread de I/O no próximo passo
+static volatile sig_atomic_t g_dump_req = 0;
+
+static void on_sigusr1(int sig)
+{
+    (void)sig;
+    g_dump_req = 1;
+}
 
-static void *load_thread_fn(void *arg)
+// Resumo (p50/p99/p99.9/max em µs) na saída padrão e buckets em CSV
+static void dump_hist(const HistSet *H, const char *path)
 {
-    (void)arg;
-    while (g_run_load)
+    printf("---- histogramas (µs) ----\n");
+    hdr_print_summary(&H->period, "periodo", 1e3, stdout);
+    hdr_print_summary(&H->jitter, "|jitter|", 1e3, stdout);
+    hdr_print_summary(&H->handoff, "handoff", 1e3, stdout);
+    fflush(stdout);
+
+    FILE *fp = fopen(path, "w");
+    if (!fp)
     {
-        // Busy work ~ 1-2 ms
-        volatile double x = 0.0;
-        for (int i = 0; i < 200000; ++i)
-            x += i * 0.000001;
-        // Curto nanosleep para não travar o sistema
-        struct timespec ts = {0, 1000000}; // 1 ms
-        nanosleep(&ts, NULL);
+        perror(path);
+        return;
     }
-    return NULL;
+    hdr_print_summary(&H->period, "# periodo", 1e3, fp);
+    hdr_print_summary(&H->jitter, "# |jitter|", 1e3, fp);
+    hdr_print_summary(&H->handoff, "# handoff", 1e3, fp);
+    fprintf(fp, "metric,lo_ns,hi_ns,count\n");
+    hdr_print_buckets(&H->period, "periodo", fp);
+    hdr_print_buckets(&H->jitter, "jitter_abs", fp);
+    hdr_print_buckets(&H->handoff, "handoff", fp);
+    fclose(fp);
+}
+
+// Custo de CPU e jitter da estratégia de despertar: tela + uma linha em
+// out/wakeup.csv (acumula execuções para comparar sleep/hybrid/spin)
+static void report_wakeup(const Wakeup *W, const HistSet *H, long long cpu_ns, long long loop_ns,
+                          const char *mode, const char *profile)
+{
+    double cpu_pct = loop_ns > 0 ? 100.0 * cpu_ns / loop_ns : 0.0;
+    double cpu_us_per = W->wakeups > 0 ? cpu_ns / 1e3 / W->wakeups : 0.0;
+    double spin_us_per = W->wakeups > 0 ? W->spin_ns / 1e3 / W->wakeups : 0.0;
+    double margin_us = W->mode == WAKE_HYBRID ? W->margin_ns / 1e3 : 0.0; // só o hybrid usa margem
+    printf("despertar %s: margem %.1f µs%s | CPU I/O %.2f%% (%.1f µs/período, giro %.1f µs) | "
+           "atraso do sono p50=%.1f p99=%.1f µs | margem estourada %lu/%lu\n",
+           wakeup_name(W->mode), margin_us, W->auto_margin ? " (auto)" : "",
+           cpu_pct, cpu_us_per, spin_us_per,
+           hdr_percentile(&W->overshoot, 50.0) / 1e3, hdr_percentile(&W->overshoot, 99.0) / 1e3,
+           W->late, W->wakeups);
+
+    const char *path = "out/wakeup.csv";
+    FILE *fp = fopen(path, "a");
+    if (!fp)
+    {
+        perror(path);
+        return;
+    }
+    if (ftell(fp) == 0)
+        fprintf(fp, "wake,mode,profile,margin_us,auto,periods,cpu_pct,cpu_us_per_period,spin_us_per_period,"
+                    "jitter_p50_us,jitter_p99_us,jitter_p999_us,jitter_max_us,late\n");
+    fprintf(fp, "%s,%s,%s,%.1f,%d,%lu,%.3f,%.2f,%.2f,%.3f,%.3f,%.3f,%.3f,%lu\n",
+            wakeup_name(W->mode), mode, profile, margin_us, W->auto_margin, W->wakeups,
+            cpu_pct, cpu_us_per, spin_us_per,
+            hdr_percentile(&H->jitter, 50.0) / 1e3, hdr_percentile(&H->jitter, 99.0) / 1e3,
+            hdr_percentile(&H->jitter, 99.9) / 1e3, H->jitter.max / 1e3, W->late);
+    fclose(fp);
 }
 
 // ====== Estrutura para passar opções à thread de I/O =====================
 typedef struct
 {
-    const char *periods_csv; // nome do CSV para T(k), J(k)
+    const char *periods_csv; // nome do CSV para T(k), J(k) (NULL = não mede)
     const char *tsv_out;     // nome do arquivo de amostras (yx, yy)
+    bool afap;               // tempo lógico: não dorme entre os passos
+    bool quiet;              // não imprime a mensagem de fim
+    bool sync_log;           // fprintf dentro do laço (comportamento antigo)
+    HistSet *hist;           // histogramas acumulados entre execuções
+    const char *hist_csv;    // destino do dump por SIGUSR1
+    const RtProfile *rt;     // perfil de tempo real
+    RtReport *rt_rep;        // o que entrou em vigor
+    Wakeup *wake;            // estratégia de despertar (margem persiste entre execuções)
+    long long cpu_ns;        // CPU da thread de I/O no laço (acumulado)
+    long long loop_ns;       // parede do laço (acumulado)
+    Trace *trace;            // entradas gravadas (NULL = simrobot_generate_u)
+    long steps;              // períodos por execução
 } IOArgs;
 
 // ====== Thread de I/O (gera u, espera y, grava arquivos e mede T/J) ======
@@ -80,14 +165,33 @@ static void *io_thread_fn(void *arg)
     fprintf(fp, "t(s)\tv(m/s)\tw(rad/s)\tyx(m)\tyy(m)\n");
 
     // Arquivo novo para períodos e jitter
-    FILE *fpP = fopen(args->periods_csv, "w");
-    if (!fpP)
+    FILE *fpP = NULL;
+    if (args->periods_csv)
     {
-        perror("Erro abrindo periods.csv");
-        exit(1);
+        fpP = fopen(args->periods_csv, "w");
+        if (!fpP)
+        {
+            perror("Erro abrindo periods.csv");
+            exit(1);
+        }
+        setvbuf(fpP, NULL, _IOFBF, 1 << 20);
+        fprintf(fpP, "k,t_wall(s),T(s),J(s)\n");
     }
-    setvbuf(fpP, NULL, _IOFBF, 1 << 20);
-    fprintf(fpP, "k,t_wall(s),T(s),J(s)\n");
+
+    // Log assíncrono: o laço só copia registros; formatação/escrita na thread de baixa prioridade.
+    // Em --afap não há laço temporizado a proteger: grava direto (evita a thread extra por execução)
+    LogAsync log;
+    bool async_log = !args->sync_log && !args->afap;
+    if (async_log && log_async_start(&log, fp, fpP, LOG_QUEUE_CAP) != 0)
+    {
+        fprintf(stderr, "Aviso: log assíncrono indisponível, usando fprintf no laço\n");
+        async_log = false;
+    }
+
+    // Perfil RT da própria thread só depois de criar a escritora do log: ela
+    // herdaria a afinidade (e a prioridade) e disputaria a CPU do laço
+    rt_apply_thread(pthread_self(), RT_IO, args->rt, args->rt_rep);
+    rt_prefault_stack(args->rt->prefault_stack, args->rt_rep);
 
     // Configuração da periodicidade ABSOLUTA
     const long long DT_NS = (long long)(DT_IDEAL * 1e9);
@@ -100,27 +204,41 @@ static void *io_thread_fn(void *arg)
     double t_k = 0.0;          // tempo lógico do início de cada passo
     long long prev_wake_ns = 0;
 
-    while (t_k < T_END - 1e-12)
-    {
-        // 1) Aguarda o instante ideal (TIMER_ABSTIME evita drift)
-        struct timespec ts_wakeup = ts_from_ns(next_wakeup_ns);
-        // Ignora retornos por sinais (simplificação), checar retorno
-        clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts_wakeup, NULL);
+    // Custo de CPU do laço (inclui o giro das estratégias hybrid/spin)
+    struct timespec cpu0, cpu1;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &cpu0);
+    long long loop0_ns = now_ns();
 
-        // 2) Marca o instante real de ativação (wake-up)
-        long long now_wake_ns = now_ns();
+    while (seq < args->steps)
+    {
+        // 1) Aguarda o instante ideal (absoluto evita drift) e 2) marca o
+        //    instante real de ativação; em --afap segue direto
+        long long now_wake_ns = args->afap ? now_ns() : wakeup_until(args->wake, next_wakeup_ns);
 
         // 3) Gera u(t_k), publica e espera y(t_{k+1})
-        double v, w;
-        simrobot_generate_u(t_k, &v, &w);
+        double v, w, t_rec;
+        if (!args->trace)
+            simrobot_generate_u(t_k, &v, &w);
+        else if (!trace_next(args->trace, &t_rec, &v, &w))
+            v = w = 0.0; // traço mais curto que o contado (arquivo mudou): para o robô
+        long long t_pub_ns = now_ns();
         simrobot_publish_input(t_k, v, w, seq);
 
         double t_next, yx, yy, theta;
         simrobot_wait_output(seq, &t_next, &yx, &yy, &theta);
+        hdr_record(&args->hist->handoff, now_ns() - t_pub_ns);
 
         // 4) Grava amostra principal (modelo)
-        fprintf(fp, "%.6f\t%.6f\t%.6f\t%.6f\t%.6f\n",
-                t_next, v, w, yx, yy);
+        if (async_log)
+        {
+            LogRecord rec = {.kind = LOG_SAMPLE, .d = {t_next, v, w, yx, yy}};
+            log_async_push(&log, &rec);
+        }
+        else
+        {
+            fprintf(fp, "%.6f\t%.6f\t%.6f\t%.6f\t%.6f\n",
+                    t_next, v, w, yx, yy);
+        }
 
         // 5) Calcula T(k) e J(k) em cima dos wake-ups
         if (seq == 0)
@@ -132,47 +250,342 @@ static void *io_thread_fn(void *arg)
             double T_s = (now_wake_ns - prev_wake_ns) / 1e9;
             double J_s = T_s - DT_IDEAL;
 
-            if (seq > WARMUP_DROP)
+            if (!args->afap && seq > WARMUP_DROP)
+            {
+                long long T_ns = now_wake_ns - prev_wake_ns;
+                long long J_ns = T_ns - DT_NS;
+                hdr_record(&args->hist->period, T_ns);
+                hdr_record(&args->hist->jitter, J_ns < 0 ? -J_ns : J_ns);
+            }
+
+            if (fpP && seq > WARMUP_DROP)
             { // ignora período de aquecimento
-                fprintf(fpP, "%d,%.9f,%.9f,%.9f\n",
-                        k_meas, now_wake_ns / 1e9, T_s, J_s);
+                if (async_log)
+                {
+                    LogRecord rec = {.kind = LOG_PERIOD, .k = k_meas, .d = {now_wake_ns / 1e9, T_s, J_s}};
+                    log_async_push(&log, &rec);
+                }
+                else
+                {
+                    fprintf(fpP, "%d,%.9f,%.9f,%.9f\n",
+                            k_meas, now_wake_ns / 1e9, T_s, J_s);
+                }
                 k_meas++;
             }
             prev_wake_ns = now_wake_ns;
         }
 
+        // Dump sob demanda (kill -USR1 <pid>)
+        if (g_dump_req)
+        {
+            g_dump_req = 0;
+            dump_hist(args->hist, args->hist_csv);
+        }
+
         // 6) Agenda o próximo disparo ideal e avança tempo lógico
         next_wakeup_ns += DT_NS;
         seq++;
         t_k += DT_IDEAL;
     }
 
-    fclose(fpP);
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &cpu1);
+    args->cpu_ns += ns_from_ts(cpu1) - ns_from_ts(cpu0);
+    args->loop_ns += now_ns() - loop0_ns;
+
+    if (async_log)
+    {
+        log_async_stop(&log);
+        if (log.dropped > 0)
+            fprintf(stderr, "Aviso: %lu registros de log descartados (fila cheia)\n", log.dropped);
+    }
+    if (fpP)
+        fclose(fpP);
     fclose(fp);
-    puts("OK: arquivos gerados.");
+    if (!args->quiet)
+        puts("OK: arquivos gerados.");
     return NULL;
 }
 
 static void print_usage(const char *prog)
 {
     fprintf(stderr,
-            "Uso: %s [--load]\n"
-            "  --load : inicia uma thread de carga para medir o jitter 'com carga'\n"
-            "Sem argumentos: mede 'sem carga'.\n",
+            "Uso: %s [--load | --stress S] [--afap] [--runs N] [--profile P] [--wake W [--margin-us X]] [--no-csv] [--sync-log] [--rk45 [--rtol X] [--atol X] | --exact] [--fleet N [--workers W] [--steps S] [--no-pin]] [--sweep [...]] [--trace F] [--trace-convert IN OUT]\n"
+            "  --load      : inicia uma thread de carga para medir o jitter 'com carga'\n"
+            "  --stress S  : carga configurável (implica --load): tipo[,threads=N][,duty=P][,cpu=C][,mb=M][,period_ms=T]\n"
+            "                tipos cpu (padrão), sin, mem, cache, syscall; config. gravada em out/stress_*.txt\n"
+            "  --afap      : tempo lógico, sem dormir (o mais rápido possível); não grava periods_*.csv\n"
+            "  --runs N    : repete o cenário N vezes e informa s simulados / s de parede\n"
+            "  --profile P : perfil de tempo real (padrão: none); saídas ganham o sufixo _P\n"
+            "  --wake W    : despertar sleep (padrão), hybrid (dorme e gira até o alvo) ou spin\n"
+            "  --margin-us X: margem fixa do hybrid em µs (padrão: automática)\n"
+            "  --no-csv    : não grava periods_*.csv (só os histogramas em out/hist_*.csv)\n"
+            "  --sync-log  : grava os arquivos com fprintf dentro do laço periódico (sem log assíncrono)\n"
+            "  --rk45      : integrador Dormand-Prince adaptativo (padrão: RK4 fixo)\n"
+            "  --rtol X    : tolerância relativa do RK45 (padrão 1e-6)\n"
+            "  --atol X    : tolerância absoluta do RK45 (padrão 1e-9)\n"
+            "  --exact     : solução fechada do uniciclo (u constante no passo; 1 sincos por passo)\n"
+            "  --fleet N   : simula frotas de 1, 2, 4, ..., N robôs em tempo lógico e\n"
+            "                grava out/fleet_scaling.csv (passos/s agregados)\n"
+            "  --workers W : threads da frota (padrão: CPUs online)\n"
+            "  --steps S   : passos por robô na frota (padrão: 4000)\n"
+            "  --no-pin    : não fixa os workers da frota em CPUs\n"
+            "  --sweep     : varredura de parâmetros + Monte Carlo em tempo lógico -> out/sweep.csv\n"
+            "                grades (listas separadas por vírgula): --dt-list, --D-list, --tend-list,\n"
+            "                --gain-list (σ do ganho de v,w), --noise-list (σ do ruído por passo);\n"
+            "                --reps R (réplicas por ponto, padrão 200), --seed S, --workers W, --rk45/--exact\n"
+            "  --trace F   : reproduz as entradas (t v w) de um traço SRTR (mmap) ou TSV, 1 por período\n"
+            "  --trace-convert IN OUT : converte um TSV (t v w ...) em traço binário SRTR e sai\n"
+            "Sem argumentos: mede 'sem carga'.\n"
+            "Histogramas de período/jitter/handoff: no fim ou com kill -USR1 <pid>.\n"
+            "Perfis:\n",
             prog);
+    rt_profile_list(stderr);
+}
+
+// ====== Modo frota: escala de passos/s com o nº de robôs ======
+static int run_fleet(size_t max_robots, unsigned workers, int steps, int pin,
+                     SimIntegrator integrator, double rtol, double atol)
+{
+    FILE *fp = fopen("out/fleet_scaling.csv", "w");
+    if (!fp)
+    {
+        perror("Erro abrindo fleet_scaling.csv");
+        return 1;
+    }
+    fprintf(fp, "robots,workers,pinned,steps,wall_s,steps_per_s\n");
+    printf("%8s %8s %7s %10s %14s\n", "robos", "workers", "fixos", "tempo(s)", "passos/s");
+
+    for (size_t n = 1;; n *= 2)
+    {
+        if (n > max_robots)
+            n = max_robots;
+        FleetConfig cfg = {
+            .robots = n,
+            .workers = workers,
+            .steps = steps,
+            .pin = pin,
+            .params = {.dt = DT_IDEAL,
+                       .t_end = DT_IDEAL * steps,
+                       .D = 0.30,
+                       .integrator = integrator,
+                       .rtol = rtol,
+                       .atol = atol}};
+        FleetReport rep;
+        if (fleet_run(&cfg, &rep) != 0)
+        {
+            fprintf(stderr, "fleet_run falhou com %zu robôs\n", n);
+            fclose(fp);
+            return 1;
+        }
+        fprintf(fp, "%zu,%u,%u,%d,%.6f,%.1f\n", n, rep.workers, rep.pinned, steps, rep.wall_s, rep.steps_per_s);
+        printf("%8zu %8u %7u %10.4f %14.0f\n", n, rep.workers, rep.pinned, rep.wall_s, rep.steps_per_s);
+        if (n == max_robots)
+            break;
+    }
+    fclose(fp);
+    puts("OK: out/fleet_scaling.csv gerado.");
+    return 0;
+}
+
+// ====== Modo varredura: grade de SimParams x perturbações da entrada ======
+#define SWEEP_MAX_LIST 32
+
+// "a,b,c" -> vetor; retorna o nº de valores (0 se vazio/inválido)
+static size_t parse_list(const char *s, double *out)
+{
+    size_t n = 0;
+    while (*s && n < SWEEP_MAX_LIST)
+    {
+        char *end = NULL;
+        out[n] = strtod(s, &end);
+        if (end == s)
+            return 0;
+        n++;
+        s = (*end == ',') ? end + 1 : end;
+    }
+    return n;
+}
+
+static int run_sweep(const SweepConfig *cfg)
+{
+    size_t n = sweep_count(cfg);
+    SweepResult *res = (SweepResult *)calloc(n, sizeof(SweepResult));
+    SweepReport rep;
+    if (!res || sweep_run(cfg, res, &rep) != 0)
+    {
+        fprintf(stderr, "sweep_run falhou (grade inválida ou sem memória)\n");
+        free(res);
+        return 1;
+    }
+    int rc = sweep_write_csv("out/sweep.csv", res, n) == 0 ? 0 : 1;
+    printf("%zu configurações, %zu execuções, %.3g passos em %.3f s (%u workers, %lu roubos): "
+           "%.0f execuções/s, %.3g passos/s\n",
+           rep.configs, rep.runs, rep.total_steps, rep.wall_s, rep.workers, rep.steals,
+           rep.runs / rep.wall_s, rep.total_steps / rep.wall_s);
+    if (rc == 0)
+        puts("OK: out/sweep.csv gerado.");
+    free(res);
+    return rc;
 }
 
 int main(int argc, char **argv)
 {
     // ====== Parse simples de argumentos ======
     bool with_load = false;
-    if (argc >= 2)
+    StressConfig stress_cfg;
+    stress_default(&stress_cfg);
+    bool afap = false;
+    int runs = 1;
+    bool sync_log = false;
+    bool no_csv = false;
+    const RtProfile *rt = rt_profile_find("none");
+    WakeMode wake_mode = WAKE_SLEEP;
+    long long margin_ns = -1;
+    SimIntegrator integrator = SIM_RK4;
+    double rtol = 0.0, atol = 0.0;
+    size_t fleet = 0;
+    unsigned fleet_workers = 0;
+    int fleet_steps = 4000;
+    int fleet_pin = 1;
+    bool sweep = false;
+    const char *trace_path = NULL;
+    double sw_dt[SWEEP_MAX_LIST] = {0.01, 0.025, 0.05, 0.1};
+    double sw_D[SWEEP_MAX_LIST] = {0.2, 0.3, 0.4};
+    double sw_tend[SWEEP_MAX_LIST] = {20.0};
+    double sw_gain[SWEEP_MAX_LIST] = {0.0, 0.02, 0.05};
+    double sw_noise[SWEEP_MAX_LIST] = {0.0, 0.05};
+    SweepConfig sw = {.dt = sw_dt, .n_dt = 4, .D = sw_D, .n_D = 3, .t_end = sw_tend, .n_t_end = 1,
+                      .gain_sigma = sw_gain, .n_gain = 3, .noise_sigma = sw_noise, .n_noise = 2,
+                      .replicates = 200, .seed = 1};
+    for (int i = 1; i < argc; ++i)
     {
-        if (strcmp(argv[1], "--load") == 0)
+        if (strcmp(argv[i], "--load") == 0)
         {
             with_load = true;
         }
-        else if (strcmp(argv[1], "-h") == 0 || strcmp(argv[1], "--help") == 0)
+        else if (strcmp(argv[i], "--stress") == 0 && i + 1 < argc)
+        {
+            if (stress_parse(argv[++i], &stress_cfg) != 0)
+            {
+                print_usage(argv[0]);
+                return 1;
+            }
+            with_load = true;
+        }
+        else if (strcmp(argv[i], "--afap") == 0)
+        {
+            afap = true;
+        }
+        else if (strcmp(argv[i], "--runs") == 0 && i + 1 < argc)
+        {
+            runs = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--profile") == 0 && i + 1 < argc)
+        {
+            rt = rt_profile_find(argv[++i]);
+            if (!rt)
+            {
+                print_usage(argv[0]);
+                return 1;
+            }
+        }
+        else if (strcmp(argv[i], "--wake") == 0 && i + 1 < argc)
+        {
+            if (wakeup_parse(argv[++i], &wake_mode) != 0)
+            {
+                print_usage(argv[0]);
+                return 1;
+            }
+        }
+        else if (strcmp(argv[i], "--margin-us") == 0 && i + 1 < argc)
+        {
+            margin_ns = (long long)(strtod(argv[++i], NULL) * 1e3);
+        }
+        else if (strcmp(argv[i], "--no-csv") == 0)
+        {
+            no_csv = true;
+        }
+        else if (strcmp(argv[i], "--sync-log") == 0)
+        {
+            sync_log = true;
+        }
+        else if (strcmp(argv[i], "--rk45") == 0)
+        {
+            integrator = SIM_RK45;
+        }
+        else if (strcmp(argv[i], "--exact") == 0)
+        {
+            integrator = SIM_EXACT;
+        }
+        else if (strcmp(argv[i], "--rtol") == 0 && i + 1 < argc)
+        {
+            rtol = strtod(argv[++i], NULL);
+        }
+        else if (strcmp(argv[i], "--atol") == 0 && i + 1 < argc)
+        {
+            atol = strtod(argv[++i], NULL);
+        }
+        else if (strcmp(argv[i], "--fleet") == 0 && i + 1 < argc)
+        {
+            fleet = strtoul(argv[++i], NULL, 10);
+        }
+        else if (strcmp(argv[i], "--workers") == 0 && i + 1 < argc)
+        {
+            fleet_workers = (unsigned)strtoul(argv[++i], NULL, 10);
+        }
+        else if (strcmp(argv[i], "--steps") == 0 && i + 1 < argc)
+        {
+            fleet_steps = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--no-pin") == 0)
+        {
+            fleet_pin = 0;
+        }
+        else if (strcmp(argv[i], "--trace") == 0 && i + 1 < argc)
+        {
+            trace_path = argv[++i];
+        }
+        else if (strcmp(argv[i], "--trace-convert") == 0 && i + 2 < argc)
+        {
+            size_t n = 0;
+            if (trace_convert_tsv(argv[i + 1], argv[i + 2], &n) != 0)
+                return 1;
+            printf("OK: %zu registros gravados em %s.\n", n, argv[i + 2]);
+            return 0;
+        }
+        else if (strcmp(argv[i], "--sweep") == 0)
+        {
+            sweep = true;
+        }
+        else if (strcmp(argv[i], "--dt-list") == 0 && i + 1 < argc)
+        {
+            sw.n_dt = parse_list(argv[++i], sw_dt);
+        }
+        else if (strcmp(argv[i], "--D-list") == 0 && i + 1 < argc)
+        {
+            sw.n_D = parse_list(argv[++i], sw_D);
+        }
+        else if (strcmp(argv[i], "--tend-list") == 0 && i + 1 < argc)
+        {
+            sw.n_t_end = parse_list(argv[++i], sw_tend);
+        }
+        else if (strcmp(argv[i], "--gain-list") == 0 && i + 1 < argc)
+        {
+            sw.n_gain = parse_list(argv[++i], sw_gain);
+        }
+        else if (strcmp(argv[i], "--noise-list") == 0 && i + 1 < argc)
+        {
+            sw.n_noise = parse_list(argv[++i], sw_noise);
+        }
+        else if (strcmp(argv[i], "--reps") == 0 && i + 1 < argc)
+        {
+            sw.replicates = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc)
+        {
+            sw.seed = strtoull(argv[++i], NULL, 10);
+        }
+        else if (strcmp(argv[i], "-h") == 0 || strcmp(argv[i], "--help") == 0)
         {
             print_usage(argv[0]);
             return 0;
@@ -184,55 +597,207 @@ int main(int argc, char **argv)
         }
     }
 
-    // ====== Inicializa parâmetros do laboratório ======
-    SimParams params = {
-        .dt = DT_IDEAL,
-        .t_end = T_END,
-        .D = 0.30};
-    simrobot_init(&params);
-
-    // ====== Inicia a thread de simulação ======
-    if (simrobot_start() != 0)
+    if (runs < 1)
     {
-        perror("pthread_create(sim)");
+        print_usage(argv[0]);
         return 1;
     }
+    if (sweep)
+    {
+        if (sweep_count(&sw) == 0 || sw.replicates < 1)
+        {
+            print_usage(argv[0]);
+            return 1;
+        }
+        sw.workers = fleet_workers;
+        sw.integrator = integrator;
+        sw.rtol = rtol;
+        sw.atol = atol;
+        return run_sweep(&sw);
+    }
+    if (fleet > 0)
+    {
+        if (fleet_steps <= 0)
+        {
+            print_usage(argv[0]);
+            return 1;
+        }
+        return run_fleet(fleet, fleet_workers, fleet_steps, fleet_pin, integrator, rtol, atol);
+    }
+
+    // ====== Perfil RT: mlockall/heap antes de criar as threads ======
+    RtReport rt_rep;
+    memset(&rt_rep, 0, sizeof(rt_rep));
+    rt_apply_process(rt, &rt_rep);
 
     // ====== [CARGA OPCIONAL] Inicia carga se solicitado ======
-    pthread_t th_load;
+    Stress *load = NULL;
     if (with_load)
     {
-        g_run_load = 1;
-        if (pthread_create(&th_load, NULL, load_thread_fn, NULL) != 0)
+        load = stress_start(&stress_cfg);
+        if (!load)
         {
-            perror("pthread_create(load)");
-            g_run_load = 0;
+            fprintf(stderr, "Aviso: carga não iniciada; seguindo sem carga\n");
+        }
+        else
+        {
+            // cpu= explícito na carga prevalece sobre a afinidade do perfil
+            for (int i = 0; i < stress_nthreads(load); ++i)
+            {
+                if (stress_cfg.cpu >= 0)
+                    rt_apply_prio(stress_thread(load, i), RT_LOAD, rt, &rt_rep);
+                else
+                    rt_apply_thread(stress_thread(load, i), RT_LOAD, rt, &rt_rep);
+            }
         }
     }
 
+    // ====== Nomes de saída por modo, perfil e despertar (padrões mantêm os nomes originais) ======
+    const char *mode = with_load ? "com_carga" : "sem_carga";
+    char suffix[32] = "";
+    if (strcmp(rt->name, "none") != 0)
+        snprintf(suffix, sizeof(suffix), "_%s", rt->name);
+    if (with_load && stress_cfg.kind != STRESS_CPU)
+    {
+        size_t len = strlen(suffix);
+        snprintf(suffix + len, sizeof(suffix) - len, "_%s", stress_kind_name(stress_cfg.kind));
+    }
+    if (wake_mode != WAKE_SLEEP)
+    {
+        size_t len = strlen(suffix);
+        snprintf(suffix + len, sizeof(suffix) - len, "_%s", wakeup_name(wake_mode));
+    }
+    char periods_path[128], hist_path[128], rt_path[128], stress_path[128];
+    snprintf(periods_path, sizeof(periods_path), "out/periods_%s%s.csv", mode, suffix);
+    snprintf(hist_path, sizeof(hist_path), "out/hist_%s%s.csv", mode, suffix);
+    snprintf(rt_path, sizeof(rt_path), "out/rt_%s%s.txt", mode, suffix);
+    snprintf(stress_path, sizeof(stress_path), "out/stress_%s%s.txt", mode, suffix);
+
     // ====== Thread de I/O: define nomes dos arquivos por modo ======
-    IOArgs io_args = {
-        .periods_csv = with_load ? "out/periods_com_carga.csv" : "out/periods_sem_carga.csv",
-        .tsv_out = "out/sim_out.tsv"};
+    hdr_init(&g_hist.period);
+    hdr_init(&g_hist.jitter);
+    hdr_init(&g_hist.handoff);
+    struct sigaction sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = on_sigusr1;
+    sigemptyset(&sa.sa_mask);
+    sigaction(SIGUSR1, &sa, NULL);
 
-    pthread_t th_io;
-    if (pthread_create(&th_io, NULL, io_thread_fn, &io_args) != 0)
+    // ====== Despertar: semeia a margem automática com sonos curtos ======
+    static Wakeup wake;
+    wakeup_init(&wake, wake_mode, margin_ns);
+    if (!afap && wake_mode == WAKE_HYBRID)
+        wakeup_calibrate(&wake, 50);
+
+    // ====== Entradas: lei do laboratório ou traço gravado (1 registro por período) ======
+    static Trace trace;
+    long steps = lround(T_END / DT_IDEAL);
+    if (trace_path)
     {
-        perror("pthread_create(io)");
-        return 1;
+        if (trace_open(&trace, trace_path) != 0)
+            return 1;
+        steps = (long)trace.count;
+        if (trace.dt > 0.0 && fabs(trace.dt - DT_IDEAL) > 1e-9)
+            fprintf(stderr, "Aviso: traço com dt = %g s, reproduzido a 1 registro por período de %g s\n",
+                    trace.dt, DT_IDEAL);
+        printf("traço %s: %zu registros (%s)\n", trace_path, trace.count, trace.map ? "SRTR, mmap" : "TSV");
     }
 
-    // ====== Aguarda término ======
-    pthread_join(th_io, NULL);
-    simrobot_join();
+    IOArgs io_args = {
+        .trace = trace_path ? &trace : NULL,
+        .steps = steps,
+        .periods_csv = (afap || no_csv) ? NULL : periods_path,
+        .hist = &g_hist,
+        .hist_csv = hist_path,
+        .rt = rt,
+        .rt_rep = &rt_rep,
+        .wake = &wake,
+        .tsv_out = "out/sim_out.tsv",
+        .afap = afap,
+        .quiet = runs > 1,
+        .sync_log = sync_log};
+
+    SimStats stats = {0};
+    long long t0_ns = now_ns();
+    for (int r = 0; r < runs; ++r)
+    {
+        // ====== Inicializa parâmetros do laboratório ======
+        SimParams params = {
+            .dt = DT_IDEAL,
+            .t_end = steps * DT_IDEAL,
+            .D = 0.30,
+            .integrator = integrator,
+            .rtol = rtol,
+            .atol = atol};
+        simrobot_init(&params);
+        if (trace_path && r > 0 && trace_rewind(&trace) != 0)
+        {
+            perror("trace_rewind");
+            return 1;
+        }
+
+        // ====== Inicia a thread de simulação ======
+        if (simrobot_start() != 0)
+        {
+            perror("pthread_create(sim)");
+            return 1;
+        }
+        pthread_t th_sim;
+        if (simrobot_get_thread(&th_sim) == 0)
+            rt_apply_thread(th_sim, RT_SIM, rt, &rt_rep);
+
+        pthread_t th_io;
+        if (pthread_create(&th_io, NULL, io_thread_fn, &io_args) != 0)
+        {
+            perror("pthread_create(io)");
+            return 1;
+        }
+
+        // ====== Aguarda término ======
+        pthread_join(th_io, NULL);
+        simrobot_join();
+        if (r == runs - 1)
+            simrobot_get_stats(&stats);
+        simrobot_destroy();
+    }
+    double wall_s = (now_ns() - t0_ns) / 1e9;
 
     // ====== Finaliza carga se estiver ativa ======
-    if (with_load && g_run_load)
+    if (load)
     {
-        g_run_load = 0;
-        pthread_join(th_load, NULL);
+        StressStats sst;
+        stress_stop(&load, &sst);
+        stress_write_config(&stress_cfg, &sst, stress_path);
+        printf("carga %s: %d thread(s), duty %d%% (medido %.1f%%) -> %s\n",
+               stress_kind_name(stress_cfg.kind), stress_cfg.threads, stress_cfg.duty,
+               100.0 * sst.busy_s / (sst.wall_s * stress_cfg.threads), stress_path);
     }
 
-    simrobot_destroy();
+    dump_hist(&g_hist, io_args.hist_csv);
+
+    // ====== Perfil RT: o que entrou em vigor (tela + arquivo ao lado dos resultados) ======
+    rt_report_print(rt, &rt_rep, stdout);
+    FILE *fp_rt = fopen(rt_path, "w");
+    if (fp_rt)
+    {
+        rt_report_print(rt, &rt_rep, fp_rt);
+        fclose(fp_rt);
+    }
+    if (!afap)
+        report_wakeup(&wake, &g_hist, io_args.cpu_ns, io_args.loop_ns, mode, rt->name);
+
+    if (integrator == SIM_RK45)
+    {
+        printf("RK45: %lu períodos, %lu passos aceitos, %lu rejeitados, %lu avaliações de f\n",
+               stats.periods, stats.accepted, stats.rejected, stats.f_evals);
+    }
+    if (afap || runs > 1)
+    {
+        double sim_s = runs * steps * DT_IDEAL;
+        printf("%d execução(ões): %.1f s simulados em %.3f s de parede = %.1f s_sim/s (%.1f execuções/min)\n",
+               runs, sim_s, wall_s, sim_s / wall_s, 60.0 * runs / wall_s);
+    }
+    if (trace_path)
+        trace_close(&trace);
     return 0;
 }
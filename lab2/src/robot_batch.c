@@ -0,0 +1,115 @@
+// robot_batch.c
+// RK4 em lote sobre a frota em SoA, com sincos polinomial vetorizável.
+// Compilado com -O3 (ver Makefile) para o vetorizador atuar nos laços.
+
+// --- Feature test macros ---
+#define _POSIX_C_SOURCE 200112L // posix_memalign
+
+#include "robot_batch.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define BATCH_ALIGN 64
+
+// ----------------- sincos polinomial -----------------
+// Arredondamento para o inteiro mais próximo sem floor/lrint (vetoriza em SSE2)
+#define ROUND_MAGIC 6755399441055744.0 // 1.5 * 2^52
+
+static const double INV_PIO2 = 6.36619772367581382433e-01;
+static const double PIO2_1   = 1.57079632673412561417e+00; // primeiros 33 bits de pi/2
+static const double PIO2_2   = 6.07710050630396597660e-11; // próximos 33 bits
+static const double PIO2_2T  = 2.02226624879595063154e-21; // resto
+
+static inline __attribute__((always_inline)) void sincos_poly(double x, double *s_out, double *c_out) {
+    // x = k*(pi/2) + r, |r| <= pi/4
+    double k = (x * INV_PIO2 + ROUND_MAGIC) - ROUND_MAGIC;
+    double r = ((x - k * PIO2_1) - k * PIO2_2) - k * PIO2_2T;
+
+    // Quadrante q = k mod 4 em double: floor(k/4) = round((k - 1.5)/4) para k inteiro
+    double q = k - 4.0 * (((k - 1.5) * 0.25 + ROUND_MAGIC) - ROUND_MAGIC);
+
+    double z = r * r;
+    double sr = r + r * z * (-1.66666666666666324348e-01 + z * (8.33333333332248946124e-03
+              + z * (-1.98412698298579493134e-04 + z * (2.75573137070700676789e-06
+              + z * (-2.50507602534068634195e-08 + z * 1.58969099521155010221e-10)))));
+    double cr = 1.0 - 0.5 * z + z * z * (4.16666666666666019037e-02 + z * (-1.38888888888741095749e-03
+              + z * (2.48015872894767294178e-05 + z * (-2.75573143513906633035e-07
+              + z * (2.08757232129817482790e-09 + z * -1.13596475577881948265e-11)))));
+
+    // q: 0 -> ( s,  c) | 1 -> ( c, -s) | 2 -> (-s, -c) | 3 -> (-c,  s)
+    int odd = (q == 1.0) | (q == 3.0);
+    double s = odd ? cr : sr;
+    double c = odd ? sr : cr;
+    *s_out = (q >= 2.0) ? -s : s;
+    *c_out = ((q == 1.0) | (q == 2.0)) ? -c : c;
+}
+
+void robot_batch_sincos(double x, double *s, double *c) {
+    sincos_poly(x, s, c);
+}
+
+// ----------------- Alocação -----------------
+static double *alloc_vec(size_t n) {
+    void *p = NULL;
+    size_t bytes = (n * sizeof(double) + BATCH_ALIGN - 1) / BATCH_ALIGN * BATCH_ALIGN;
+    if (posix_memalign(&p, BATCH_ALIGN, bytes) != 0) return NULL;
+    memset(p, 0, bytes);
+    return (double *)p;
+}
+
+int robot_batch_init(RobotBatch *B, size_t n) {
+    memset(B, 0, sizeof(*B));
+    B->x = alloc_vec(n);
+    B->y = alloc_vec(n);
+    B->theta = alloc_vec(n);
+    B->v = alloc_vec(n);
+    B->w = alloc_vec(n);
+    if (!B->x || !B->y || !B->theta || !B->v || !B->w) {
+        robot_batch_free(B);
+        return -1;
+    }
+    B->n = n;
+    return 0;
+}
+
+void robot_batch_free(RobotBatch *B) {
+    free(B->x);
+    free(B->y);
+    free(B->theta);
+    free(B->v);
+    free(B->w);
+    memset(B, 0, sizeof(*B));
+}
+
+// ----------------- Passos -----------------
+void robot_batch_rk4(RobotBatch *B, double dt) {
+    double *restrict px = __builtin_assume_aligned(B->x, BATCH_ALIGN);
+    double *restrict py = __builtin_assume_aligned(B->y, BATCH_ALIGN);
+    double *restrict pt = __builtin_assume_aligned(B->theta, BATCH_ALIGN);
+    const double *restrict pv = __builtin_assume_aligned(B->v, BATCH_ALIGN);
+    const double *restrict pw = __builtin_assume_aligned(B->w, BATCH_ALIGN);
+    const size_t n = B->n;
+
+    for (size_t i = 0; i < n; ++i) {
+        double th = pt[i], v = pv[i], w = pw[i];
+        double s1, c1, s2, c2, s4, c4;
+        sincos_poly(th, &s1, &c1);
+        sincos_poly(th + 0.5 * dt * w, &s2, &c2); // estágios 2 e 3
+        sincos_poly(th + dt * w, &s4, &c4);
+
+        // Mesma ordem de somas do rk4_step escalar (k2 == k3)
+        px[i] += (dt / 6.0) * (v * s1 + 2.0 * (v * s2) + 2.0 * (v * s2) + v * s4);
+        py[i] += (dt / 6.0) * (v * c1 + 2.0 * (v * c2) + 2.0 * (v * c2) + v * c4);
+        pt[i] += (dt / 6.0) * (w + 2.0 * w + 2.0 * w + w);
+    }
+}
+
+void robot_batch_front(const RobotBatch *B, double D, double *yx, double *yy) {
+    for (size_t i = 0; i < B->n; ++i) {
+        double s, c;
+        sincos_poly(B->theta[i], &s, &c);
+        yx[i] = B->x[i] + 0.5 * D * c;
+        yy[i] = B->y[i] + 0.5 * D * s;
+    }
+}
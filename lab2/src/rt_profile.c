@@ -0,0 +1,115 @@
+// rt_profile.c
+// Perfis de tempo real (SCHED_FIFO, afinidade, mlockall, pré-falta) com
+// fallback: cada ajuste que falha é só registrado.
+
+// --- Feature test macros ---
+#define _GNU_SOURCE // pthread_setaffinity_np, CPU_SET, mallopt
+
+#include "rt_profile.h"
+
+#include <errno.h>
+#include <malloc.h>
+#include <sched.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#define KiB ((size_t)1024)
+#define MiB (1024 * KiB)
+
+static const char *ROLE_NAME[RT_NROLES] = {"io", "sim", "load"};
+
+static const RtProfile PROFILES[] = {
+    {"none",  "padrão do sistema (SCHED_OTHER, sem afinidade)",
+     {0, 0, 0}, {RT_CPU_NONE, RT_CPU_NONE, RT_CPU_NONE}, 0, 0, 0},
+    {"fifo",  "SCHED_FIFO para I/O (80) e simulação (79); carga em SCHED_OTHER",
+     {80, 79, 0}, {RT_CPU_NONE, RT_CPU_NONE, RT_CPU_NONE}, 0, 0, 0},
+    {"pin",   "I/O e simulação na última CPU, carga na CPU 0",
+     {0, 0, 0}, {RT_CPU_LAST, RT_CPU_LAST, 0}, 0, 0, 0},
+    {"full",  "fifo + pin + mlockall + pré-falta (pilha 256 KiB, heap 8 MiB)",
+     {80, 79, 0}, {RT_CPU_LAST, RT_CPU_LAST, 0}, 1, 256 * KiB, 8 * MiB},
+};
+
+const RtProfile *rt_profile_find(const char *name) {
+    for (size_t i = 0; i < sizeof(PROFILES) / sizeof(PROFILES[0]); ++i)
+        if (strcmp(PROFILES[i].name, name) == 0) return &PROFILES[i];
+    return NULL;
+}
+
+void rt_profile_list(FILE *fp) {
+    for (size_t i = 0; i < sizeof(PROFILES) / sizeof(PROFILES[0]); ++i)
+        fprintf(fp, "    %-5s : %s\n", PROFILES[i].name, PROFILES[i].desc);
+}
+
+void rt_apply_process(const RtProfile *P, RtReport *rep) {
+    if (P->mlock) {
+        rep->mlock = (mlockall(MCL_CURRENT | MCL_FUTURE) == 0) ? 1 : -errno;
+    }
+    if (P->prefault_heap > 0) {
+        // Não devolver o heap ao sistema nem usar mmap para blocos grandes:
+        // as páginas tocadas aqui continuam residentes para os mallocs seguintes
+        mallopt(M_TRIM_THRESHOLD, -1);
+        mallopt(M_MMAP_MAX, 0);
+        char *p = (char *)malloc(P->prefault_heap);
+        if (p) {
+            long page = sysconf(_SC_PAGESIZE);
+            if (page <= 0) page = 4096;
+            for (size_t i = 0; i < P->prefault_heap; i += (size_t)page) p[i] = 1;
+            free(p);
+            rep->heap_touched = P->prefault_heap;
+        }
+    }
+}
+
+void rt_apply_prio(pthread_t th, RtRole role, const RtProfile *P, RtReport *rep) {
+    if (P->fifo_prio[role] > 0) {
+        struct sched_param sp = {.sched_priority = P->fifo_prio[role]};
+        int rc = pthread_setschedparam(th, SCHED_FIFO, &sp);
+        rep->fifo[role] = (rc == 0) ? 1 : -rc;
+    }
+}
+
+void rt_apply_thread(pthread_t th, RtRole role, const RtProfile *P, RtReport *rep) {
+    rt_apply_prio(th, role, P, rep);
+    if (P->cpu[role] != RT_CPU_NONE) {
+        long ncpu = sysconf(_SC_NPROCESSORS_ONLN);
+        if (ncpu < 1) ncpu = 1;
+        int cpu = (P->cpu[role] == RT_CPU_LAST) ? (int)ncpu - 1 : P->cpu[role] % (int)ncpu;
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(cpu, &set);
+        int rc = pthread_setaffinity_np(th, sizeof(set), &set);
+        rep->cpu[role] = (rc == 0) ? 1 : -rc;
+        rep->cpu_used[role] = cpu;
+    }
+}
+
+void rt_prefault_stack(size_t bytes, RtReport *rep) {
+    if (bytes == 0) return;
+    // VLA tocada página a página; o ponteiro volatile impede o compilador de remover
+    char buf[bytes];
+    volatile char *p = buf;
+    for (size_t i = 0; i < bytes; i += 4096) p[i] = 0;
+    p[bytes - 1] = 0;
+    rep->stack_touched = bytes;
+}
+
+static const char *status(int s) {
+    if (s == 0) return "não pedido";
+    if (s > 0) return "ok";
+    return strerror(-s);
+}
+
+void rt_report_print(const RtProfile *P, const RtReport *rep, FILE *fp) {
+    fprintf(fp, "perfil RT: %s (%s)\n", P->name, P->desc);
+    for (int r = 0; r < RT_NROLES; ++r) {
+        fprintf(fp, "  %-4s SCHED_FIFO %-3d: %-24s", ROLE_NAME[r], P->fifo_prio[r], status(rep->fifo[r]));
+        if (rep->cpu[r] != 0)
+            fprintf(fp, " CPU %d: %s\n", rep->cpu_used[r], status(rep->cpu[r]));
+        else
+            fprintf(fp, " CPU -: não pedido\n");
+    }
+    fprintf(fp, "  mlockall: %s | pilha pré-faltada: %zu KiB | heap pré-faltado: %zu KiB\n",
+            status(rep->mlock), rep->stack_touched / KiB, rep->heap_touched / KiB);
+}
@@ -1,6 +1,8 @@
 // sim_robot.c
 // Modelo do robô diferencial, integrador RK4 e thread de simulação.
 // A thread de simulação mantém o estado x e só se comunica por u(t) e y_f(t).
+// Cada robô é uma instância SimRobot; a API global (simrobot_*) usa uma
+// instância padrão estática.
 
 // --- Feature test macros ---
 #define _POSIX_C_SOURCE 199309L
@@ -11,15 +13,16 @@
 #endif
 
 #include "sim_robot.h"
+#ifndef SIMROBOT_LEGACY_MAILBOX
+#include "spsc.h"
+#endif
 
 #include <math.h>
 #include <pthread.h>
+#include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
 
-// ----------------- Armazenamento de parâmetros -----------------
-static SimParams g_params = {0};
-
 // ----------------- Mailboxes internas (protegidas) -----------------
 typedef struct {
     double v, w;     // entrada
@@ -34,20 +37,47 @@ typedef struct {
     double t;        // tempo t_{k+1} (fim do passo)
 } OutputMB;
 
-static InputMB  g_input;
-static OutputMB g_output;
-
-// Sinalização
-static pthread_mutex_t g_mtx      = PTHREAD_MUTEX_INITIALIZER;
-static pthread_cond_t  g_cond_in  = PTHREAD_COND_INITIALIZER;
-static pthread_cond_t  g_cond_out = PTHREAD_COND_INITIALIZER;
+// ----------------- Estado de uma instância -----------------
+struct SimRobot {
+    SimParams params;
+
+    // Estado contínuo (só a thread de simulação / sim_step mexe)
+    double x[3];
+    double t_cur;
+    double h_prop;   // SIM_RK45: passo proposto pelo controle (persiste entre períodos)
+    double cs_c, cs_s;   // SIM_EXACT: cos/sin de cs_theta, propagados por rotação
+    double cs_theta;
+    int    cs_age;       // passos desde o último cos/sin da libm (-1 = inválido)
+    SimStats stats;
+
+#ifdef SIMROBOT_LEGACY_MAILBOX
+    // Esquema original: uma caixa de cada lado + mutex/condvar (1 passo em voo)
+    InputMB  input;
+    OutputMB output;
+
+    // Sinalização
+    pthread_mutex_t mtx;
+    pthread_cond_t  cond_in;
+    pthread_cond_t  cond_out;
+
+    int input_seq;   // última entrada publicada
+    int output_seq;  // última saída publicada
+#else
+    // Filas SPSC lock-free (I/O -> sim e sim -> I/O): até SIMROBOT_RING_CAP passos em voo
+    SpscRing in_ring;
+    SpscRing out_ring;
+    InputMB  in_storage[SIMROBOT_RING_CAP];
+    OutputMB out_storage[SIMROBOT_RING_CAP];
+#endif
 
-static int g_input_seq  = -1;  // última entrada publicada
-static int g_output_seq = -1;  // última saída publicada
+    // Thread de simulação
+    pthread_t thread;
+    int       started;
+};
 
-// Thread de simulação
-static pthread_t g_sim_thread;
-static int       g_sim_started = 0;
+// Instância usada pela API global (sem alocação)
+static SimRobot g_default;
+static int      g_default_ready = 0;
 
 // ----------------- Dinâmica contínua e utilitários -----------------
 static inline void f_dyn(const double x[3], double v, double w, double dx[3]) {
@@ -79,133 +109,394 @@ static void rk4_step(double x[3], double v, double w, double dt) {
     }
 }
 
+// ----------------- Dormand-Prince 5(4) -----------------
+// Tableau (f_dyn é autônoma: os nós c_i não são necessários)
+static const double DP_A21 = 1.0/5;
+static const double DP_A31 = 3.0/40,       DP_A32 = 9.0/40;
+static const double DP_A41 = 44.0/45,      DP_A42 = -56.0/15,      DP_A43 = 32.0/9;
+static const double DP_A51 = 19372.0/6561, DP_A52 = -25360.0/2187, DP_A53 = 64448.0/6561, DP_A54 = -212.0/729;
+static const double DP_A61 = 9017.0/3168,  DP_A62 = -355.0/33,     DP_A63 = 46732.0/5247, DP_A64 = 49.0/176,
+                    DP_A65 = -5103.0/18656;
+// Pesos da solução de 5ª ordem (= linha 7: FSAL)
+static const double DP_B1 = 35.0/384, DP_B3 = 500.0/1113, DP_B4 = 125.0/192, DP_B5 = -2187.0/6784,
+                    DP_B6 = 11.0/84;
+// Diferença 5ª - 4ª ordem (estimativa de erro)
+static const double DP_E1 = 71.0/57600, DP_E3 = -71.0/16695, DP_E4 = 71.0/1920, DP_E5 = -17253.0/339200,
+                    DP_E6 = 22.0/525,   DP_E7 = -1.0/40;
+
+#define DP_SAFETY   0.9
+#define DP_MIN_FAC  0.2
+#define DP_MAX_FAC  5.0
+
+/*
+ * Integra x por um período dt com u constante. Os passos internos são
+ * cortados para terminar exatamente em t_{k+1}: a entrada muda ali, e
+ * atravessar a descontinuidade estragaria a estimativa de erro. O passo
+ * proposto pelo controle não é reduzido por esse corte e vale para o
+ * próximo período.
+ */
+static void dopri_period(SimRobot *R, double v, double w) {
+    const double T = R->params.dt;
+    const double rtol = (R->params.rtol > 0.0) ? R->params.rtol : 1e-6;
+    const double atol = (R->params.atol > 0.0) ? R->params.atol : 1e-9;
+    double *x = R->x;
+    double t = 0.0;
+    double h_prop = (R->h_prop > 0.0) ? R->h_prop : T;
+    double k1[3], k2[3], k3[3], k4[3], k5[3], k6[3], k7[3], xt[3], x5[3];
+
+    f_dyn(x, v, w, k1); // FSAL só vale dentro do período (u muda em t_{k+1})
+    R->stats.f_evals++;
+
+    while (t < T) {
+        double h = h_prop;
+        int last = 0;
+        if (h >= T - t) { h = T - t; last = 1; }
+
+        for (int i = 0; i < 3; ++i) xt[i] = x[i] + h * DP_A21 * k1[i];
+        f_dyn(xt, v, w, k2);
+        for (int i = 0; i < 3; ++i) xt[i] = x[i] + h * (DP_A31 * k1[i] + DP_A32 * k2[i]);
+        f_dyn(xt, v, w, k3);
+        for (int i = 0; i < 3; ++i) xt[i] = x[i] + h * (DP_A41 * k1[i] + DP_A42 * k2[i] + DP_A43 * k3[i]);
+        f_dyn(xt, v, w, k4);
+        for (int i = 0; i < 3; ++i)
+            xt[i] = x[i] + h * (DP_A51 * k1[i] + DP_A52 * k2[i] + DP_A53 * k3[i] + DP_A54 * k4[i]);
+        f_dyn(xt, v, w, k5);
+        for (int i = 0; i < 3; ++i)
+            xt[i] = x[i] + h * (DP_A61 * k1[i] + DP_A62 * k2[i] + DP_A63 * k3[i] + DP_A64 * k4[i]
+                                + DP_A65 * k5[i]);
+        f_dyn(xt, v, w, k6);
+        for (int i = 0; i < 3; ++i)
+            x5[i] = x[i] + h * (DP_B1 * k1[i] + DP_B3 * k3[i] + DP_B4 * k4[i] + DP_B5 * k5[i] + DP_B6 * k6[i]);
+        f_dyn(x5, v, w, k7);
+        R->stats.f_evals += 6;
+
+        // Norma RMS do erro escalado
+        double err = 0.0;
+        for (int i = 0; i < 3; ++i) {
+            double e  = h * (DP_E1 * k1[i] + DP_E3 * k3[i] + DP_E4 * k4[i] + DP_E5 * k5[i]
+                             + DP_E6 * k6[i] + DP_E7 * k7[i]);
+            double sc = atol + rtol * fmax(fabs(x[i]), fabs(x5[i]));
+            err += (e / sc) * (e / sc);
+        }
+        err = sqrt(err / 3.0);
+
+        double fac = (err > 0.0) ? DP_SAFETY * pow(err, -0.2) : DP_MAX_FAC;
+        fac = fmin(DP_MAX_FAC, fmax(DP_MIN_FAC, fac));
+
+        if (err <= 1.0 || h <= 1e-12 * T) {
+            // Aceito (passos minúsculos são aceitos para garantir término)
+            for (int i = 0; i < 3; ++i) { x[i] = x5[i]; k1[i] = k7[i]; }
+            t = last ? T : t + h;
+            R->stats.accepted++;
+            double h_new = h * fac;
+            // Passo cortado pelo fim do período: não encolhe a proposta
+            h_prop = (last && h < h_prop) ? fmax(h_prop, h_new) : h_new;
+        } else {
+            R->stats.rejected++;
+            h_prop = h * fac;
+        }
+    }
+    R->h_prop = h_prop;
+}
+
+// ----------------- Solução exata (SIM_EXACT) -----------------
+// Com v, w constantes no período e h = w dt / 2, theta_m = theta + h:
+//   x1 += v dt sinc(h) sin(theta_m),  x2 += v dt sinc(h) cos(theta_m),  x3 += w dt
+// (mesma convenção sin/cos de f_dyn). O único sincos é o de h; cos/sin de
+// theta vêm do passo anterior por rotação e são renovados pela libm a cada
+// EXACT_REFRESH passos para não acumular arredondamento.
+#define EXACT_SERIES_H 1e-4  // |h| abaixo disso: sinc(h) = 1 - h^2/6 (erro < h^4/120)
+#define EXACT_REFRESH  64
+
+static void exact_step(SimRobot *R, double v, double w) {
+    double dt = R->params.dt, th0 = R->x[2];
+    if (R->cs_age < 0 || R->cs_age >= EXACT_REFRESH || R->cs_theta != th0) {
+        R->cs_c = cos(th0);
+        R->cs_s = sin(th0);
+        R->cs_age = 0;
+    }
+    double h = 0.5 * w * dt;
+    double sh = sin(h), ch = cos(h);
+    double sinc = (fabs(h) < EXACT_SERIES_H) ? 1.0 - h * h / 6.0 : sh / h;
+
+    // Ângulo médio e final por rotação de (c, s)
+    double cm = R->cs_c * ch - R->cs_s * sh, sm = R->cs_s * ch + R->cs_c * sh;
+    double L = v * dt * sinc;
+    R->x[0] += L * sm;
+    R->x[1] += L * cm;
+    R->x[2] = th0 + w * dt;
+
+    R->cs_c = cm * ch - sm * sh;
+    R->cs_s = sm * ch + cm * sh;
+    R->cs_theta = R->x[2];
+    R->cs_age++;
+}
+
 static inline void front_point(const double x[3], double D, double *yx, double *yy) {
     *yx = x[0] + 0.5 * D * cos(x[2]);
     *yy = x[1] + 0.5 * D * sin(x[2]);
 }
 
-// ----------------- API pública -----------------
-void simrobot_init(const SimParams *params) {
+// ----------------- Instâncias -----------------
+static void sim_setup(SimRobot *R, const SimParams *params) {
     if (params) {
-        g_params = *params;
+        R->params = *params;
     } else {
-        g_params.dt = 0.05;
-        g_params.t_end = 20.0;
-        g_params.D = 0.30;
+        R->params.dt = 0.05;
+        R->params.t_end = 20.0;
+        R->params.D = 0.30;
     }
-    // Zera caixas de correio e sequências
-    pthread_mutex_lock(&g_mtx);
-    memset(&g_input, 0, sizeof(g_input));
-    memset(&g_output, 0, sizeof(g_output));
-    g_input_seq  = -1;
-    g_output_seq = -1;
-    pthread_mutex_unlock(&g_mtx);
+    R->x[0] = R->x[1] = R->x[2] = 0.0; // x(0)=0
+    R->t_cur = 0.0;
+    R->h_prop = 0.0;
+    R->cs_age = -1;
+    memset(&R->stats, 0, sizeof(R->stats));
+    R->started = 0;
+
+#ifdef SIMROBOT_LEGACY_MAILBOX
+    memset(&R->input, 0, sizeof(R->input));
+    memset(&R->output, 0, sizeof(R->output));
+    R->input_seq  = -1;
+    R->output_seq = -1;
+    pthread_mutex_init(&R->mtx, NULL);
+    pthread_cond_init(&R->cond_in, NULL);
+    pthread_cond_init(&R->cond_out, NULL);
+#else
+    // Capacidade é potência de 2: spsc_init não falha aqui
+    spsc_init(&R->in_ring,  R->in_storage,  sizeof(InputMB),  SIMROBOT_RING_CAP);
+    spsc_init(&R->out_ring, R->out_storage, sizeof(OutputMB), SIMROBOT_RING_CAP);
+#endif
 }
 
-void simrobot_destroy(void) {
-    // Opcional: destruir mutex/cond se desejar reutilizar processo várias vezes
-    pthread_mutex_destroy(&g_mtx);
-    pthread_cond_destroy(&g_cond_in);
-    pthread_cond_destroy(&g_cond_out);
+static void sim_teardown(SimRobot *R) {
+#ifdef SIMROBOT_LEGACY_MAILBOX
+    pthread_mutex_destroy(&R->mtx);
+    pthread_cond_destroy(&R->cond_in);
+    pthread_cond_destroy(&R->cond_out);
+#else
+    (void)R;
+#endif
 }
 
-void simrobot_publish_input(double t_k, double v, double w, int seq) {
-    pthread_mutex_lock(&g_mtx);
-    g_input.t   = t_k;
-    g_input.v   = v;
-    g_input.w   = w;
-    g_input.seq = seq;
-    g_input_seq = seq;
-    pthread_cond_signal(&g_cond_in);
-    pthread_mutex_unlock(&g_mtx);
+SimRobot *sim_create(const SimParams *params) {
+    // As filas SPSC têm campos alinhados à linha de cache: malloc só garante 16 bytes
+    const size_t align = _Alignof(SimRobot);
+    SimRobot *R = (SimRobot *)aligned_alloc(align, (sizeof(SimRobot) + align - 1) / align * align);
+    if (!R) return NULL;
+    sim_setup(R, params);
+    return R;
 }
 
-void simrobot_wait_output(int expected_seq, double *t_next, double *yx, double *yy, double *theta) {
-    pthread_mutex_lock(&g_mtx);
-    while (g_output_seq < expected_seq) {
-        pthread_cond_wait(&g_cond_out, &g_mtx);
-    }
-    if (t_next) *t_next = g_output.t;
-    if (yx)     *yx     = g_output.yx;
-    if (yy)     *yy     = g_output.yy;
-    if (theta)  *theta  = g_output.theta;
-    pthread_mutex_unlock(&g_mtx);
+void sim_destroy(SimRobot **R) {
+    if (!R || !*R) return;
+    sim_join(*R);
+    sim_teardown(*R);
+    free(*R);
+    *R = NULL;
 }
 
-void simrobot_generate_u(double t, double *v, double *w) {
-    if (t < 0.0) { 
-        if(v) *v = 0.0; 
-        if(w) *w = 0.0; 
-        return; 
+void sim_step(SimRobot *R, double v, double w, double *t_next, double *yx, double *yy, double *theta) {
+    // Integra 1 período e calcula y_f
+    if (R->params.integrator == SIM_RK45) {
+        dopri_period(R, v, w);
+    } else if (R->params.integrator == SIM_EXACT) {
+        exact_step(R, v, w);
+        R->stats.accepted++;
+    } else {
+        rk4_step(R->x, v, w, R->params.dt);
+        R->stats.accepted++;
+        R->stats.f_evals += 4;
     }
-    if (t < 10.0) { 
-        if(v) *v = 1.0; 
-        if(w) *w = 0.2 * M_PI; 
-        return; 
+    R->stats.periods++;
+    R->t_cur += R->params.dt;
+
+    double fx, fy;
+    if (R->params.integrator == SIM_EXACT) {
+        // cos/sin de theta já conhecidos: nenhum trig extra para y_f
+        fx = R->x[0] + 0.5 * R->params.D * R->cs_c;
+        fy = R->x[1] + 0.5 * R->params.D * R->cs_s;
+    } else {
+        front_point(R->x, R->params.D, &fx, &fy);
     }
-    if(v) *v = 1.0; 
-    if(w) *w = -0.2 * M_PI;
+    if (t_next) *t_next = R->t_cur;
+    if (yx)     *yx     = fx;
+    if (yy)     *yy     = fy;
+    if (theta)  *theta  = R->x[2];
+}
+
+int sim_get_thread(const SimRobot *R, pthread_t *th) {
+    if (!R->started) return -1;
+    if (th) *th = R->thread;
+    return 0;
+}
+
+void sim_get_stats(const SimRobot *R, SimStats *stats) {
+    if (stats) *stats = R->stats;
+}
+
+#ifndef SIMROBOT_LEGACY_MAILBOX
+void sim_publish_input(SimRobot *R, double t_k, double v, double w, int seq) {
+    InputMB in = { .v = v, .w = w, .seq = seq, .t = t_k };
+    spsc_push(&R->in_ring, &in); // só bloqueia se SIMROBOT_RING_CAP passos estiverem pendentes
+}
+
+void sim_wait_output(SimRobot *R, int expected_seq, double *t_next, double *yx, double *yy, double *theta) {
+    // Saídas chegam em ordem de seq: descarta as anteriores a expected_seq
+    OutputMB out;
+    do {
+        spsc_pop(&R->out_ring, &out);
+    } while (out.seq < expected_seq);
+    if (t_next) *t_next = out.t;
+    if (yx)     *yx     = out.yx;
+    if (yy)     *yy     = out.yy;
+    if (theta)  *theta  = out.theta;
+}
+#else
+void sim_publish_input(SimRobot *R, double t_k, double v, double w, int seq) {
+    pthread_mutex_lock(&R->mtx);
+    R->input.t   = t_k;
+    R->input.v   = v;
+    R->input.w   = w;
+    R->input.seq = seq;
+    R->input_seq = seq;
+    pthread_cond_signal(&R->cond_in);
+    pthread_mutex_unlock(&R->mtx);
+}
+
+void sim_wait_output(SimRobot *R, int expected_seq, double *t_next, double *yx, double *yy, double *theta) {
+    pthread_mutex_lock(&R->mtx);
+    while (R->output_seq < expected_seq) {
+        pthread_cond_wait(&R->cond_out, &R->mtx);
+    }
+    if (t_next) *t_next = R->output.t;
+    if (yx)     *yx     = R->output.yx;
+    if (yy)     *yy     = R->output.yy;
+    if (theta)  *theta  = R->output.theta;
+    pthread_mutex_unlock(&R->mtx);
 }
+#endif
 
 // ----------------- Thread de simulação (interna) -----------------
 static void *sim_thread_fn(void *arg) {
-    (void)arg;
-    double x[3] = {0.0, 0.0, 0.0};  // x(0)=0
-    double t_cur = 0.0;
+    SimRobot *R = (SimRobot *)arg;
+#ifdef SIMROBOT_LEGACY_MAILBOX
     int last_consumed_in = -1;
+#endif
 
-    const double dt = g_params.dt;
-    const double D  = g_params.D;
-    const double T_end = g_params.t_end;
+    // Conta períodos em vez de comparar t acumulado: em traços longos a soma
+    // de dt deriva e o fim poderia cair um passo antes/depois da thread de I/O
+    const unsigned long n_steps = (unsigned long)llround(R->params.t_end / R->params.dt);
 
     while (1) {
         // 1) Espera a próxima entrada (seq > last_consumed_in)
         double v, w;
         int my_seq;
 
-        pthread_mutex_lock(&g_mtx);
-        while (g_input_seq <= last_consumed_in) {
-            pthread_cond_wait(&g_cond_in, &g_mtx);
+#ifdef SIMROBOT_LEGACY_MAILBOX
+        pthread_mutex_lock(&R->mtx);
+        while (R->input_seq <= last_consumed_in) {
+            pthread_cond_wait(&R->cond_in, &R->mtx);
         }
-        v = g_input.v;
-        w = g_input.w;
-        my_seq = g_input.seq;
-        pthread_mutex_unlock(&g_mtx);
-
-        // 2) Integra 1 passo
-        rk4_step(x, v, w, dt);
-        t_cur += dt;
-
-        // 3) Calcula y_f e publica
-        double yx, yy;
-        front_point(x, D, &yx, &yy);
-
-        pthread_mutex_lock(&g_mtx);
-        g_output.yx   = yx;
-        g_output.yy   = yy;
-        g_output.theta= x[2];
-        g_output.t    = t_cur;
-        g_output.seq  = my_seq;
-        g_output_seq  = my_seq;
-        pthread_cond_signal(&g_cond_out);
-        pthread_mutex_unlock(&g_mtx);
+        v = R->input.v;
+        w = R->input.w;
+        my_seq = R->input.seq;
+        pthread_mutex_unlock(&R->mtx);
+#else
+        InputMB in;
+        spsc_pop(&R->in_ring, &in);
+        v = in.v;
+        w = in.w;
+        my_seq = in.seq;
+#endif
+
+        // 2) Integra 1 passo e calcula y_f
+        double t_next, yx, yy, theta;
+        sim_step(R, v, w, &t_next, &yx, &yy, &theta);
+
+        // 3) Publica
+#ifdef SIMROBOT_LEGACY_MAILBOX
+        pthread_mutex_lock(&R->mtx);
+        R->output.yx    = yx;
+        R->output.yy    = yy;
+        R->output.theta = theta;
+        R->output.t     = t_next;
+        R->output.seq   = my_seq;
+        R->output_seq   = my_seq;
+        pthread_cond_signal(&R->cond_out);
+        pthread_mutex_unlock(&R->mtx);
 
         last_consumed_in = my_seq;
+#else
+        OutputMB out = { .yx = yx, .yy = yy, .theta = theta, .seq = my_seq, .t = t_next };
+        spsc_push(&R->out_ring, &out);
+#endif
 
-        if (t_cur >= T_end - 1e-12) break;
+        if (R->stats.periods >= n_steps) break;
     }
     return NULL;
 }
 
-int simrobot_start(void) {
-    if (g_sim_started) return 0;
-    int rc = pthread_create(&g_sim_thread, NULL, sim_thread_fn, NULL);
-    if (rc == 0) g_sim_started = 1;
+int sim_start(SimRobot *R) {
+    if (R->started) return 0;
+    int rc = pthread_create(&R->thread, NULL, sim_thread_fn, R);
+    if (rc == 0) R->started = 1;
     return rc;
 }
 
+void sim_join(SimRobot *R) {
+    if (!R->started) return;
+    pthread_join(R->thread, NULL);
+    R->started = 0;
+}
+
+// ----------------- API pública (instância padrão) -----------------
+void simrobot_init(const SimParams *params) {
+    if (g_default_ready) sim_teardown(&g_default);
+    sim_setup(&g_default, params);
+    g_default_ready = 1;
+}
+
+void simrobot_destroy(void) {
+    if (!g_default_ready) return;
+    sim_teardown(&g_default);
+    g_default_ready = 0;
+}
+
+void simrobot_publish_input(double t_k, double v, double w, int seq) {
+    sim_publish_input(&g_default, t_k, v, w, seq);
+}
+
+void simrobot_wait_output(int expected_seq, double *t_next, double *yx, double *yy, double *theta) {
+    sim_wait_output(&g_default, expected_seq, t_next, yx, yy, theta);
+}
+
+int simrobot_get_thread(pthread_t *th) {
+    return sim_get_thread(&g_default, th);
+}
+
+void simrobot_get_stats(SimStats *stats) {
+    sim_get_stats(&g_default, stats);
+}
+
+void simrobot_generate_u(double t, double *v, double *w) {
+    if (t < 0.0) { 
+        if(v) *v = 0.0; 
+        if(w) *w = 0.0; 
+        return; 
+    }
+    if (t < 10.0) { 
+        if(v) *v = 1.0; 
+        if(w) *w = 0.2 * M_PI; 
+        return; 
+    }
+    if(v) *v = 1.0; 
+    if(w) *w = -0.2 * M_PI;
+}
+
+int simrobot_start(void) {
+    return sim_start(&g_default);
+}
+
 void simrobot_join(void) {
-    if (!g_sim_started) return;
-    pthread_join(g_sim_thread, NULL);
-    g_sim_started = 0;
+    sim_join(&g_default);
 }
@@ -0,0 +1,125 @@
+// spsc.c
+// Fila SPSC lock-free com bloqueio por futex só quando vazia/cheia.
+
+// --- Feature test macros ---
+#define _GNU_SOURCE // syscall()
+
+#include "spsc.h"
+
+#include <string.h>
+
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#else
+#include <sched.h>
+#endif
+
+// ----------------- Futex (com fallback por yield fora do Linux) -----------------
+static void futex_wait(_Atomic uint32_t *addr, uint32_t expected) {
+#ifdef __linux__
+    // Retorna imediatamente (EAGAIN) se *addr != expected: sem wake perdido
+    syscall(SYS_futex, (uint32_t *)addr, FUTEX_WAIT_PRIVATE, expected, NULL, NULL, 0);
+#else
+    while (atomic_load(addr) == expected) sched_yield();
+#endif
+}
+
+static void futex_wake(_Atomic uint32_t *addr) {
+#ifdef __linux__
+    syscall(SYS_futex, (uint32_t *)addr, FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0);
+#else
+    (void)addr;
+#endif
+}
+
+// ----------------- API -----------------
+int spsc_init(SpscRing *r, void *storage, size_t elem_size, size_t capacity) {
+    if (!r || !storage || elem_size == 0 || capacity < 2 || (capacity & (capacity - 1)) != 0)
+        return -1;
+    memset(r, 0, sizeof(*r));
+    atomic_init(&r->tail, 0);
+    atomic_init(&r->head, 0);
+    atomic_init(&r->pushes, 0);
+    atomic_init(&r->pops, 0);
+    atomic_init(&r->prod_waiting, 0);
+    atomic_init(&r->cons_waiting, 0);
+    r->buf = (unsigned char *)storage;
+    r->elem_size = elem_size;
+    r->mask = capacity - 1;
+    return 0;
+}
+
+bool spsc_try_push(SpscRing *r, const void *elem) {
+    size_t t = atomic_load_explicit(&r->tail, memory_order_relaxed);
+    if (t - r->cached_head > r->mask) {
+        r->cached_head = atomic_load_explicit(&r->head, memory_order_acquire);
+        if (t - r->cached_head > r->mask) return false; // cheia
+    }
+    memcpy(r->buf + (t & r->mask) * r->elem_size, elem, r->elem_size);
+    atomic_store_explicit(&r->tail, t + 1, memory_order_release);
+
+    // Acorda o consumidor só se ele anunciou que vai dormir. A cerca ordena o
+    // store de tail antes da leitura do flag (par da cerca em spsc_pop); o
+    // RMW na palavra do futex e a syscall só acontecem com alguém dormindo.
+    atomic_thread_fence(memory_order_seq_cst);
+    if (atomic_load_explicit(&r->cons_waiting, memory_order_relaxed)) {
+        atomic_fetch_add(&r->pushes, 1);
+        futex_wake(&r->pushes);
+    }
+    return true;
+}
+
+bool spsc_try_pop(SpscRing *r, void *elem) {
+    size_t h = atomic_load_explicit(&r->head, memory_order_relaxed);
+    if (h == r->cached_tail) {
+        r->cached_tail = atomic_load_explicit(&r->tail, memory_order_acquire);
+        if (h == r->cached_tail) return false; // vazia
+    }
+    memcpy(elem, r->buf + (h & r->mask) * r->elem_size, r->elem_size);
+    atomic_store_explicit(&r->head, h + 1, memory_order_release);
+
+    atomic_thread_fence(memory_order_seq_cst);
+    if (atomic_load_explicit(&r->prod_waiting, memory_order_relaxed)) {
+        atomic_fetch_add(&r->pops, 1);
+        futex_wake(&r->pops);
+    }
+    return true;
+}
+
+/*
+ * Protocolo de espera (igual nos dois lados): anuncia 'waiting', cerca
+ * seq_cst, lê a palavra do futex, re-tenta e só então dorme esperando que a
+ * palavra mude. As duas cercas (aqui e depois do store de tail/head no outro
+ * lado) garantem que ao menos um lado vê o outro: ou a re-tentativa vê o
+ * elemento, ou o outro lado vê 'waiting', incrementa a palavra e faz o wake
+ * (se isso ocorrer antes do FUTEX_WAIT, ele retorna na hora).
+ */
+void spsc_push(SpscRing *r, const void *elem) {
+    while (!spsc_try_push(r, elem)) {
+        atomic_store(&r->prod_waiting, 1);
+        atomic_thread_fence(memory_order_seq_cst);
+        uint32_t seen = atomic_load(&r->pops);
+        if (spsc_try_push(r, elem)) { atomic_store(&r->prod_waiting, 0); return; }
+        futex_wait(&r->pops, seen);
+        atomic_store(&r->prod_waiting, 0);
+    }
+}
+
+void spsc_pop(SpscRing *r, void *elem) {
+    while (!spsc_try_pop(r, elem)) {
+        atomic_store(&r->cons_waiting, 1);
+        atomic_thread_fence(memory_order_seq_cst);
+        uint32_t seen = atomic_load(&r->pushes);
+        if (spsc_try_pop(r, elem)) { atomic_store(&r->cons_waiting, 0); return; }
+        futex_wait(&r->pushes, seen);
+        atomic_store(&r->cons_waiting, 0);
+    }
+}
+
+size_t spsc_size(const SpscRing *r) {
+    size_t t = atomic_load_explicit(&r->tail, memory_order_acquire);
+    size_t h = atomic_load_explicit(&r->head, memory_order_acquire);
+    return t - h;
+}
@@ -0,0 +1,245 @@
+// sweep.c
+// Varredura de SimParams + Monte Carlo de entradas perturbadas, distribuída
+// por ws_pool (tempo lógico, sim_step na thread do worker).
+
+// --- Feature test macros ---
+#define _POSIX_C_SOURCE 200809L
+
+#include "sweep.h"
+#include "ws_pool.h"
+
+#include <math.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+// Uma execução: o que precisa ser guardado até a agregação
+typedef struct {
+    double yx, yy, theta;
+    double err_rms, err_final;
+} RunOut;
+
+typedef struct {
+    SimParams params;
+    double    gain_sigma, noise_sigma;
+    long      steps;
+    double   *nom;       // trajetória nominal: yx, yy intercalados (2*steps)
+} SweepCase;
+
+typedef struct {
+    const SweepConfig *cfg;
+    SweepCase         *cases;
+    RunOut            *runs;   // [caso * replicates + réplica]
+    atomic_int         failed; // algum sim_create falhou
+} SweepCtx;
+
+// ----------------- RNG (splitmix64 + Box-Muller) -----------------
+
+static inline uint64_t splitmix64(uint64_t *s) {
+    uint64_t z = (*s += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+static inline double uniform01(uint64_t *s) {
+    return ((splitmix64(s) >> 11) + 0.5) * (1.0 / 9007199254740992.0); // (0, 1)
+}
+
+static inline void normal2(uint64_t *s, double *a, double *b) {
+    double r = sqrt(-2.0 * log(uniform01(s)));
+    double phi = 2.0 * M_PI * uniform01(s);
+    *a = r * cos(phi);
+    *b = r * sin(phi);
+}
+
+// ----------------- Tarefas -----------------
+
+// Fase 1: trajetória nominal de cada caso
+static void nominal_task(size_t c, unsigned worker, void *arg) {
+    (void)worker;
+    SweepCtx *X = (SweepCtx *)arg;
+    SweepCase *C = &X->cases[c];
+    SimRobot *R = sim_create(&C->params);
+    if (!R) { X->failed = 1; return; }
+    for (long k = 0; k < C->steps; ++k) {
+        double v, w;
+        simrobot_generate_u(k * C->params.dt, &v, &w); // t_k = k dt: sem deriva da soma
+        sim_step(R, v, w, NULL, &C->nom[2 * k], &C->nom[2 * k + 1], NULL);
+    }
+    sim_destroy(&R);
+}
+
+// Fase 2: uma réplica perturbada, comparada com a nominal do mesmo caso
+static void replicate_task(size_t task, unsigned worker, void *arg) {
+    (void)worker;
+    SweepCtx *X = (SweepCtx *)arg;
+    size_t c = task / (size_t)X->cfg->replicates;
+    SweepCase *C = &X->cases[c];
+    RunOut *out = &X->runs[task];
+
+    uint64_t s = X->cfg->seed ^ (0xD1B54A32D192ED03ULL * (task + 1));
+    double gv = 0.0, gw = 0.0;
+    normal2(&s, &gv, &gw);
+    gv *= C->gain_sigma;
+    gw *= C->gain_sigma;
+
+    SimRobot *R = sim_create(&C->params);
+    if (!R) { X->failed = 1; return; }
+    double yx = 0.0, yy = 0.0, th = 0.0, e2 = 0.0, e = 0.0;
+    for (long k = 0; k < C->steps; ++k) {
+        double v, w, nv = 0.0, nw = 0.0;
+        simrobot_generate_u(k * C->params.dt, &v, &w);
+        if (C->noise_sigma > 0.0) normal2(&s, &nv, &nw);
+        v = v * (1.0 + gv) + C->noise_sigma * nv;
+        w = w * (1.0 + gw) + C->noise_sigma * nw;
+        sim_step(R, v, w, NULL, &yx, &yy, &th);
+        double dx = yx - C->nom[2 * k], dy = yy - C->nom[2 * k + 1];
+        e = sqrt(dx * dx + dy * dy);
+        e2 += e * e;
+    }
+    sim_destroy(&R);
+
+    out->yx = yx;
+    out->yy = yy;
+    out->theta = th;
+    out->err_rms = sqrt(e2 / (double)C->steps);
+    out->err_final = e;
+}
+
+// ----------------- API -----------------
+
+size_t sweep_count(const SweepConfig *cfg) {
+    return cfg->n_dt * cfg->n_D * cfg->n_t_end * cfg->n_gain * cfg->n_noise;
+}
+
+// Desvio padrão amostral a partir da soma dos quadrados dos desvios à média
+static double sample_std(double ss, int n) {
+    return n > 1 ? sqrt(ss / (n - 1)) : 0.0;
+}
+
+int sweep_run(const SweepConfig *cfg, SweepResult *out, SweepReport *rep) {
+    size_t n = sweep_count(cfg);
+    if (n == 0 || cfg->replicates < 1) return -1;
+
+    SweepCtx X = {.cfg = cfg};
+    atomic_init(&X.failed, 0);
+    X.cases = (SweepCase *)calloc(n, sizeof(SweepCase));
+    X.runs = (RunOut *)calloc(n * (size_t)cfg->replicates, sizeof(RunOut));
+    int rc = (X.cases && X.runs) ? 0 : -1;
+
+    // Monta os casos: o último eixo (noise) varia mais rápido
+    double total_steps = 0.0;
+    size_t c = 0;
+    for (size_t a = 0; a < cfg->n_dt && rc == 0; ++a)
+    for (size_t b = 0; b < cfg->n_D && rc == 0; ++b)
+    for (size_t d = 0; d < cfg->n_t_end && rc == 0; ++d)
+    for (size_t g = 0; g < cfg->n_gain && rc == 0; ++g)
+    for (size_t h = 0; h < cfg->n_noise && rc == 0; ++h, ++c) {
+        SweepCase *C = &X.cases[c];
+        C->params = (SimParams){.dt = cfg->dt[a], .t_end = cfg->t_end[d], .D = cfg->D[b],
+                                .integrator = cfg->integrator, .rtol = cfg->rtol,
+                                .atol = cfg->atol};
+        C->gain_sigma = cfg->gain_sigma[g];
+        C->noise_sigma = cfg->noise_sigma[h];
+        C->steps = (C->params.dt > 0.0) ? lround(C->params.t_end / C->params.dt) : 0;
+        if (C->steps <= 0) { rc = -1; break; }
+        C->nom = (double *)malloc(2 * (size_t)C->steps * sizeof(double));
+        if (!C->nom) rc = -1;
+        total_steps += (double)C->steps * (cfg->replicates + 1);
+    }
+
+    WsPoolStats s1 = {0}, s2 = {0};
+    if (rc == 0) rc = ws_pool_run(n, cfg->workers, nominal_task, &X, &s1);
+    if (rc == 0 && !X.failed)
+        rc = ws_pool_run(n * (size_t)cfg->replicates, cfg->workers, replicate_task, &X, &s2);
+    if (X.failed) rc = -1;
+
+    // Agregação por caso (serial: custo desprezível frente às simulações)
+    for (size_t i = 0; i < n && rc == 0; ++i) {
+        const SweepCase *C = &X.cases[i];
+        const RunOut *r = &X.runs[i * (size_t)cfg->replicates];
+        int m = cfg->replicates;
+        double sx = 0, sy = 0, st = 0;
+        double erms = 0, erms_max = 0, efin = 0, efin_max = 0;
+        for (int j = 0; j < m; ++j) {
+            sx += r[j].yx;
+            sy += r[j].yy;
+            st += r[j].theta;
+            erms += r[j].err_rms;
+            efin += r[j].err_final;
+            if (r[j].err_rms > erms_max) erms_max = r[j].err_rms;
+            if (r[j].err_final > efin_max) efin_max = r[j].err_final;
+        }
+        // Segunda passada: desvios à média (sum2 - n*mean² cancela quando a
+        // dispersão é pequena perto da média)
+        double mx = sx / m, my = sy / m, mt = st / m;
+        double ssx = 0, ssy = 0, sst = 0;
+        for (int j = 0; j < m; ++j) {
+            double dx = r[j].yx - mx, dy = r[j].yy - my, dth = r[j].theta - mt;
+            ssx += dx * dx;
+            ssy += dy * dy;
+            sst += dth * dth;
+        }
+        SweepResult *o = &out[i];
+        o->dt = C->params.dt;
+        o->D = C->params.D;
+        o->t_end = C->params.t_end;
+        o->gain_sigma = C->gain_sigma;
+        o->noise_sigma = C->noise_sigma;
+        o->runs = m;
+        o->steps = C->steps;
+        o->yx_nom = C->nom[2 * (C->steps - 1)];
+        o->yy_nom = C->nom[2 * (C->steps - 1) + 1];
+        o->yx_mean = mx;
+        o->yx_std = sample_std(ssx, m);
+        o->yy_mean = my;
+        o->yy_std = sample_std(ssy, m);
+        o->theta_mean = mt;
+        o->theta_std = sample_std(sst, m);
+        o->err_rms_mean = erms / m;
+        o->err_rms_max = erms_max;
+        o->err_final_mean = efin / m;
+        o->err_final_max = efin_max;
+    }
+
+    if (rep) {
+        rep->configs = n;
+        rep->runs = n * ((size_t)cfg->replicates + 1);
+        rep->total_steps = total_steps;
+        rep->workers = s2.workers;
+        rep->steals = s1.steals + s2.steals;
+        rep->wall_s = s1.wall_s + s2.wall_s;
+    }
+
+    if (X.cases)
+        for (size_t i = 0; i < n; ++i) free(X.cases[i].nom);
+    free(X.cases);
+    free(X.runs);
+    return rc;
+}
+
+int sweep_write_csv(const char *path, const SweepResult *res, size_t n) {
+    FILE *fp = fopen(path, "w");
+    if (!fp) {
+        perror(path);
+        return -1;
+    }
+    fprintf(fp, "dt,D,t_end,gain_sigma,noise_sigma,runs,steps,yx_nom,yy_nom,"
+                "yx_mean,yx_std,yy_mean,yy_std,theta_mean,theta_std,"
+                "err_rms_mean,err_rms_max,err_final_mean,err_final_max\n");
+    for (size_t i = 0; i < n; ++i) {
+        const SweepResult *r = &res[i];
+        fprintf(fp, "%g,%g,%g,%g,%g,%d,%ld,%.6f,%.6f,%.6f,%.3e,%.6f,%.3e,%.6f,%.3e,%.3e,%.3e,%.3e,%.3e\n",
+                r->dt, r->D, r->t_end, r->gain_sigma, r->noise_sigma, r->runs, r->steps,
+                r->yx_nom, r->yy_nom, r->yx_mean, r->yx_std, r->yy_mean, r->yy_std,
+                r->theta_mean, r->theta_std, r->err_rms_mean, r->err_rms_max,
+                r->err_final_mean, r->err_final_max);
+    }
+    fclose(fp);
+    return 0;
+}
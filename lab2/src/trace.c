@@ -0,0 +1,242 @@
+// trace.c
+// Reprodução de traços de entrada: binário mapeado (mmap) ou TSV convertido na abertura.
+
+// --- Feature test macros ---
+#define _DEFAULT_SOURCE // MAP_POPULATE
+
+#include "trace.h"
+
+#include <ctype.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// ----------------- Medição de dt (uniforme ou não) -----------------
+typedef struct {
+    size_t n;
+    double t0, t_prev, dt;
+    int    uniform;
+} DtMeter;
+
+static void dt_add(DtMeter *M, double t) {
+    if (M->n == 0) {
+        M->t0 = t;
+        M->uniform = 1;
+    } else if (M->n == 1) {
+        M->dt = t - M->t0;
+        if (M->dt <= 0.0) M->uniform = 0;
+    } else if (M->uniform && fabs((t - M->t_prev) - M->dt) > 1e-9 + 1e-12 * fabs(t)) {
+        M->uniform = 0;
+    }
+    M->t_prev = t;
+    M->n++;
+}
+
+static double dt_get(const DtMeter *M) {
+    return (M->n >= 2 && M->uniform) ? M->dt : 0.0;
+}
+
+// ----------------- TSV: linhas a partir do buffer grande -----------------
+
+// Próxima linha (terminada em NUL, dentro de buf) ou NULL no fim do arquivo
+static char *tsv_line(Trace *T) {
+    for (;;) {
+        char *start = T->buf + T->buf_pos;
+        size_t avail = T->buf_len - T->buf_pos;
+        char *nl = memchr(start, '\n', avail);
+        if (nl) {
+            *nl = '\0';
+            T->buf_pos = (size_t)(nl + 1 - T->buf);
+            if (T->skip) { // fim da linha longa descartada
+                T->skip = 0;
+                continue;
+            }
+            return start;
+        }
+        if (T->eof) {
+            if (avail == 0 || T->skip) return NULL;
+            T->buf[T->buf_len] = '\0'; // última linha sem '\n'
+            T->buf_pos = T->buf_len;
+            return start;
+        }
+        // Move o pedaço de linha para o início e completa o buffer
+        memmove(T->buf, start, avail);
+        T->buf_len = avail;
+        T->buf_pos = 0;
+        if (avail == TRACE_TSV_BUF || (T->skip && avail > 0)) {
+            // Linha maior que o buffer: descarta até o próximo '\n'
+            T->buf_len = 0;
+            T->skip = 1;
+            avail = 0;
+        }
+        ssize_t r = read(T->fd, T->buf + avail, TRACE_TSV_BUF - avail);
+        if (r < 0 && errno == EINTR) continue;
+        if (r < 0) T->read_err = errno;
+        if (r <= 0) T->eof = 1;
+        else T->buf_len += (size_t)r;
+    }
+}
+
+// t v w nas 3 primeiras colunas; 0 para cabeçalhos, comentários e linhas inválidas
+static int tsv_record(const char *line, TraceRecord *r) {
+    const char *p = line;
+    while (*p == ' ' || *p == '\t') ++p;
+    if (!(isdigit((unsigned char)*p) || *p == '-' || *p == '+' || *p == '.')) return 0;
+    char *end;
+    r->t = strtod(p, &end);
+    if (end == p) return 0;
+    p = end;
+    r->v = strtod(p, &end);
+    if (end == p) return 0;
+    p = end;
+    r->w = strtod(p, &end);
+    return end != p;
+}
+
+// Converte o arquivo inteiro para T->recs (capacidade dobrada conforme
+// cresce). Retorna 0, ou -1 com a causa em stderr.
+static int tsv_load(Trace *T, DtMeter *M, const char *path) {
+    size_t cap = 0;
+    TraceRecord r;
+    char *line;
+    while ((line = tsv_line(T)) != NULL) {
+        if (!tsv_record(line, &r)) continue;
+        if (M->n == cap) {
+            size_t ncap = cap ? 2 * cap : 4096;
+            TraceRecord *p = NULL;
+            if (ncap <= SIZE_MAX / sizeof(TraceRecord))
+                p = (TraceRecord *)realloc(T->recs, ncap * sizeof(TraceRecord));
+            if (!p) {
+                fprintf(stderr, "%s: sem memória para %zu registros\n", path, ncap);
+                return -1;
+            }
+            T->recs = p;
+            cap = ncap;
+        }
+        T->recs[M->n] = r;
+        dt_add(M, r.t);
+    }
+    if (T->read_err) {
+        fprintf(stderr, "%s: erro de leitura: %s\n", path, strerror(T->read_err));
+        return -1;
+    }
+    return 0;
+}
+
+// ----------------- API -----------------
+
+int trace_open(Trace *T, const char *path) {
+    memset(T, 0, sizeof(*T));
+    T->fd = open(path, O_RDONLY);
+    if (T->fd < 0) {
+        perror(path);
+        return -1;
+    }
+
+    TraceHeader h;
+    ssize_t got = pread(T->fd, &h, sizeof(h), 0);
+    if (got == (ssize_t)sizeof(h) && memcmp(h.magic, TRACE_MAGIC, 4) == 0) {
+        // ---- Binário: valida e mapeia o arquivo inteiro ----
+        struct stat st;
+        // count == 0 deixaria a thread de simulação esperando uma entrada que
+        // nunca vem; count enorme faria o produto abaixo dar a volta
+        if (fstat(T->fd, &st) != 0 || h.version != TRACE_VERSION || h.count == 0 ||
+            h.count > (SIZE_MAX - sizeof(h)) / sizeof(TraceRecord) ||
+            (uint64_t)st.st_size != sizeof(h) + h.count * sizeof(TraceRecord)) {
+            fprintf(stderr, "%s: traço SRTR inválido (versão, nº de registros ou tamanho)\n", path);
+            trace_close(T);
+            return -1;
+        }
+        int flags = MAP_PRIVATE;
+#ifdef MAP_POPULATE
+        flags |= MAP_POPULATE; // faltas de página agora, não no laço periódico
+#endif
+        T->map_len = (size_t)st.st_size;
+        T->map = mmap(NULL, T->map_len, PROT_READ, flags, T->fd, 0);
+        if (T->map == MAP_FAILED) {
+            T->map = NULL;
+            perror("mmap");
+            trace_close(T);
+            return -1;
+        }
+        madvise(T->map, T->map_len, MADV_SEQUENTIAL);
+        close(T->fd);
+        T->fd = -1;
+        T->rec = (const TraceRecord *)((const char *)T->map + sizeof(h));
+        T->n = T->count = (size_t)h.count;
+        T->dt = h.dt;
+        return 0;
+    }
+
+    // ---- TSV: buffer grande, convertido inteiro antes do laço periódico ----
+    DtMeter M = {0};
+    T->buf = (char *)malloc(TRACE_TSV_BUF + 1);
+    if (!T->buf) {
+        fprintf(stderr, "%s: sem memória para o buffer de leitura (%u bytes)\n", path, TRACE_TSV_BUF);
+        trace_close(T);
+        return -1;
+    }
+    if (tsv_load(T, &M, path) != 0) {
+        trace_close(T);
+        return -1;
+    }
+    free(T->buf);
+    T->buf = NULL;
+    close(T->fd);
+    T->fd = -1;
+    if (M.n == 0) {
+        fprintf(stderr, "%s: nenhum registro (t v w) encontrado\n", path);
+        trace_close(T);
+        return -1;
+    }
+    T->rec = T->recs;
+    T->n = T->count = M.n;
+    T->dt = dt_get(&M);
+    return 0;
+}
+
+void trace_close(Trace *T) {
+    if (T->map) munmap(T->map, T->map_len);
+    if (T->fd >= 0) close(T->fd);
+    free(T->buf);
+    free(T->recs);
+    memset(T, 0, sizeof(*T));
+    T->fd = -1;
+}
+
+int trace_rewind(Trace *T) {
+    T->pos = 0;
+    return 0;
+}
+
+int trace_convert_tsv(const char *tsv_path, const char *bin_path, size_t *count) {
+    Trace T;
+    if (trace_open(&T, tsv_path) != 0) return -1;
+    if (T.map) {
+        fprintf(stderr, "%s: já é um traço binário\n", tsv_path);
+        trace_close(&T);
+        return -1;
+    }
+    FILE *fp = fopen(bin_path, "wb");
+    if (!fp) {
+        perror(bin_path);
+        trace_close(&T);
+        return -1;
+    }
+    TraceHeader h = {.version = TRACE_VERSION, .count = T.count, .dt = T.dt};
+    memcpy(h.magic, TRACE_MAGIC, 4);
+    int rc = fwrite(&h, sizeof(h), 1, fp) == 1 ? 0 : -1;
+    size_t written = 0;
+    if (rc == 0) written = fwrite(T.rec, sizeof(TraceRecord), T.count, fp);
+    if (fclose(fp) != 0 || written != T.count) rc = -1;
+    if (rc != 0) fprintf(stderr, "%s: erro de escrita\n", bin_path);
+    if (count) *count = written;
+    trace_close(&T);
+    return rc;
+}
@@ -0,0 +1,108 @@
+// wakeup.c
+// Espera até um instante absoluto: sono puro, sono + giro curto, ou giro.
+
+// --- Feature test macros ---
+#define _POSIX_C_SOURCE 200809L
+
+#include "wakeup.h"
+
+#include <errno.h>
+#include <string.h>
+#include <time.h>
+
+// Dica de pausa para o laço de giro (libera recursos do núcleo para o irmão SMT)
+static inline void cpu_relax(void) {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    __asm__ __volatile__("yield");
+#endif
+}
+
+static inline long long mono_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (long long)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+static void sleep_abs(long long ns) {
+    struct timespec ts = {.tv_sec = ns / 1000000000LL, .tv_nsec = ns % 1000000000LL};
+    // Interrompido por sinal (ex.: SIGUSR1): volta a dormir até o mesmo instante
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR)
+        ;
+}
+
+static const char *MODE_NAME[] = {"sleep", "hybrid", "spin"};
+
+int wakeup_parse(const char *name, WakeMode *mode) {
+    for (int m = WAKE_SLEEP; m <= WAKE_SPIN; ++m) {
+        if (strcmp(name, MODE_NAME[m]) == 0) {
+            *mode = (WakeMode)m;
+            return 0;
+        }
+    }
+    return -1;
+}
+
+const char *wakeup_name(WakeMode mode) {
+    return MODE_NAME[mode];
+}
+
+void wakeup_init(Wakeup *W, WakeMode mode, long long margin_ns) {
+    memset(W, 0, sizeof(*W));
+    W->mode = mode;
+    W->auto_margin = margin_ns < 0;
+    W->margin_ns = W->auto_margin ? WAKE_MARGIN_PAD_NS : margin_ns;
+    hdr_init(&W->overshoot);
+}
+
+// Atualiza o pico (decai ~3% por amostra) e a margem: pico + 25% + folga
+static void observe(Wakeup *W, long long over_ns) {
+    if (over_ns < 0) over_ns = 0;
+    hdr_record(&W->overshoot, over_ns);
+    W->peak_ns -= W->peak_ns >> 5;
+    if (over_ns > W->peak_ns) W->peak_ns = over_ns;
+    if (W->auto_margin) {
+        long long m = W->peak_ns + W->peak_ns / 4 + WAKE_MARGIN_PAD_NS;
+        W->margin_ns = m < WAKE_MARGIN_MAX_NS ? m : WAKE_MARGIN_MAX_NS;
+    }
+}
+
+void wakeup_calibrate(Wakeup *W, int samples) {
+    if (!W->auto_margin) return;
+    for (int i = 0; i < samples; ++i) {
+        long long target = mono_ns() + 1000000LL;
+        sleep_abs(target);
+        observe(W, mono_ns() - target);
+    }
+}
+
+long long wakeup_until(Wakeup *W, long long target_ns) {
+    long long t;
+    W->wakeups++;
+
+    if (W->mode == WAKE_SLEEP) {
+        sleep_abs(target_ns);
+        t = mono_ns();
+        observe(W, t - target_ns);
+        return t;
+    }
+
+    long long spin_from = target_ns;
+    if (W->mode == WAKE_HYBRID) {
+        long long sleep_to = target_ns - W->margin_ns;
+        sleep_abs(sleep_to);
+        spin_from = mono_ns();
+        observe(W, spin_from - sleep_to);
+        if (spin_from >= target_ns) {
+            W->late++;
+            return spin_from;
+        }
+    } else {
+        spin_from = mono_ns();
+    }
+
+    while ((t = mono_ns()) < target_ns) cpu_relax();
+    W->spin_ns += t - spin_from;
+    return t;
+}
@@ -0,0 +1,143 @@
+// ws_pool.c
+// Pool fork-join com roubo de faixas de tarefas (um CAS por tarefa/roubo).
+
+// --- Feature test macros ---
+#define _POSIX_C_SOURCE 200809L
+
+#include "ws_pool.h"
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+#define WS_MAX_WORKERS 256
+
+// Faixa [lo, hi) empacotada: lo nos 32 bits baixos, hi nos altos
+#define WS_PACK(lo, hi) (((uint64_t)(hi) << 32) | (uint32_t)(lo))
+#define WS_LO(r)        ((uint32_t)(r))
+#define WS_HI(r)        ((uint32_t)((r) >> 32))
+
+typedef struct {
+    _Alignas(64) _Atomic uint64_t range;
+    unsigned long steals;
+} WsQueue;
+
+typedef struct {
+    WsQueue  *q;
+    unsigned  nw;
+    WsTaskFn  fn;
+    void     *ctx;
+} WsPool;
+
+typedef struct {
+    WsPool  *P;
+    unsigned id;
+} WsArg;
+
+static inline long long now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (long long)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+// Dono: tira a tarefa da frente da própria faixa
+static int take(WsQueue *q, uint32_t *task) {
+    uint64_t r = atomic_load_explicit(&q->range, memory_order_acquire);
+    while (WS_LO(r) < WS_HI(r)) {
+        if (atomic_compare_exchange_weak_explicit(&q->range, &r, WS_PACK(WS_LO(r) + 1, WS_HI(r)),
+                                                  memory_order_acq_rel, memory_order_acquire)) {
+            *task = WS_LO(r);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+// Ladrão: leva a metade de trás (arredondada para cima) da faixa da vítima
+static int steal(WsQueue *victim, uint32_t *lo, uint32_t *hi) {
+    uint64_t r = atomic_load_explicit(&victim->range, memory_order_acquire);
+    while (WS_LO(r) < WS_HI(r)) {
+        uint32_t n = WS_HI(r) - WS_LO(r);
+        uint32_t mid = WS_HI(r) - (n + 1) / 2;
+        if (atomic_compare_exchange_weak_explicit(&victim->range, &r, WS_PACK(WS_LO(r), mid),
+                                                  memory_order_acq_rel, memory_order_acquire)) {
+            *lo = mid;
+            *hi = WS_HI(r);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static void *worker_fn(void *arg) {
+    WsArg *A = (WsArg *)arg;
+    WsPool *P = A->P;
+    WsQueue *self = &P->q[A->id];
+
+    for (;;) {
+        uint32_t t;
+        while (take(self, &t)) P->fn(t, A->id, P->ctx);
+
+        // Faixa vazia: procura vítima a partir do vizinho. As tarefas nunca
+        // aumentam, então uma volta inteira sem sucesso significa fim.
+        int got = 0;
+        for (unsigned k = 1; k < P->nw && !got; ++k) {
+            uint32_t lo, hi;
+            if (steal(&P->q[(A->id + k) % P->nw], &lo, &hi)) {
+                // Só o dono escreve numa faixa vazia (ladrões não mexem nela)
+                atomic_store_explicit(&self->range, WS_PACK(lo, hi), memory_order_release);
+                self->steals++;
+                got = 1;
+            }
+        }
+        if (!got) return NULL;
+    }
+}
+
+int ws_pool_run(size_t n_tasks, unsigned workers, WsTaskFn fn, void *ctx, WsPoolStats *st) {
+    if (n_tasks > UINT32_MAX) return -1;
+
+    long ncpu = sysconf(_SC_NPROCESSORS_ONLN);
+    if (ncpu < 1) ncpu = 1;
+    unsigned nw = workers ? workers : (unsigned)ncpu;
+    if (nw > WS_MAX_WORKERS) nw = WS_MAX_WORKERS;
+    if (n_tasks > 0 && nw > n_tasks) nw = (unsigned)n_tasks;
+    if (nw == 0) nw = 1;
+
+    WsQueue *q = aligned_alloc(64, nw * sizeof(WsQueue));
+    if (!q) return -1;
+    for (unsigned i = 0; i < nw; ++i) {
+        atomic_init(&q[i].range, WS_PACK(n_tasks * i / nw, n_tasks * (i + 1) / nw));
+        q[i].steals = 0;
+    }
+
+    WsPool P = {.q = q, .nw = nw, .fn = fn, .ctx = ctx};
+    WsArg args[WS_MAX_WORKERS];
+    pthread_t th[WS_MAX_WORKERS];
+    int created[WS_MAX_WORKERS] = {0};
+    long long t0 = now_ns();
+
+    for (unsigned i = 1; i < nw; ++i) {
+        args[i] = (WsArg){.P = &P, .id = i};
+        created[i] = (pthread_create(&th[i], NULL, worker_fn, &args[i]) == 0);
+        // Sem thread, a faixa dela é roubada pelos outros
+    }
+    args[0] = (WsArg){.P = &P, .id = 0};
+    worker_fn(&args[0]);
+
+    unsigned long steals = q[0].steals;
+    for (unsigned i = 1; i < nw; ++i) {
+        if (created[i]) pthread_join(th[i], NULL);
+        steals += q[i].steals;
+    }
+    if (st) {
+        st->workers = nw;
+        st->steals = steals;
+        st->wall_s = (now_ns() - t0) / 1e9;
+    }
+    free(q);
+    return 0;
+}
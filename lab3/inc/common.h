@@ -36,6 +36,5 @@
 #define TH_MY      "model_y"
 #define TH_REF     "ref"
 #define TH_UI      "ui"
-#define TH_LOAD    "load"
 
 #endif
@@ -8,6 +8,7 @@
 #include "ref_model.h"
 #include "reference.h"
 #include "ui.h"
+#include "stress.h"
 
 static void *run_thread(void *(*fn)(void*), const char *name, struct timespec *t0, pthread_t *th) {
     (void)name;
@@ -17,19 +18,52 @@ static void *run_thread(void *(*fn)(void*), const char *name, struct timespec *t
     return NULL;
 }
 
+static void usage(const char *prog) {
+    fprintf(stderr,
+            "Uso: %s [--load | --stress tipo[,threads=N][,duty=P][,cpu=C][,mb=M][,period_ms=T]]\n"
+            "  --load   : carga de CPU como a antiga (1 thread de sin(), 9 ms de trabalho a cada 10 ms)\n"
+            "  --stress : carga configurável (cpu, sin, mem, cache, syscall); implica --load\n",
+            prog);
+}
+
+// Carga do --load: reproduz a antiga th_load, que fazia 500000 sin() (~8,7 ms)
+// e dormia 1 ms, ou seja ~90% ocupada, para os números de perf_load.csv
+// continuarem comparáveis com as execuções anteriores.
+static void load_default(StressConfig *cfg) {
+    stress_default(cfg);
+    cfg->kind = STRESS_SIN;
+    cfg->duty = 90;
+    cfg->period_ns = 10000000LL; // 10 ms
+}
+
 int main(int argc, char **argv) {
-    bool with_load = false;
-    if (argc > 1 && strcmp(argv[1], "--load")==0) with_load = true;
+    bool with_load = false, with_stress = false;
+    StressConfig stress_cfg; stress_default(&stress_cfg);
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--load")==0) with_load = true;
+        else if (strcmp(argv[i], "--stress")==0 && i + 1 < argc) {
+            if (stress_parse(argv[++i], &stress_cfg) != 0) { usage(argv[0]); return 1; }
+            with_load = with_stress = true;
+        }
+        else { usage(argv[0]); return 1; }
+    }
+    if (with_load && !with_stress) load_default(&stress_cfg);
 
     monitor_init(&G);
     struct timespec t0; clock_gettime(CLOCK_MONOTONIC, &t0);
 
-    // arquivos de log
-    perf_open(with_load ? "out/perf_load.csv" : "out/perf_noload.csv");
+    // arquivos de log (carga diferente da sin() do --load ganha o sufixo do tipo)
+    char perf_path[128] = "out/perf_noload.csv", stress_path[128] = "";
+    if (with_load) {
+        const char *sfx = stress_cfg.kind == STRESS_SIN ? "" : stress_kind_name(stress_cfg.kind);
+        snprintf(perf_path, sizeof(perf_path), "out/perf_load%s%s.csv", *sfx ? "_" : "", sfx);
+        snprintf(stress_path, sizeof(stress_path), "out/stress_load%s%s.txt", *sfx ? "_" : "", sfx);
+    }
+    perf_open(perf_path);
     traj_open("out/traj.csv");
 
     // threads
-    pthread_t thr_robot, thr_lin, thr_ctrl, thr_mx, thr_my, thr_ref, thr_ui, thr_load;
+    pthread_t thr_robot, thr_lin, thr_ctrl, thr_mx, thr_my, thr_ref, thr_ui;
 
     run_thread(th_robot, TH_ROBOT, &t0, &thr_robot);
     run_thread(th_linearization, TH_LIN, &t0, &thr_lin);
@@ -39,7 +73,9 @@ int main(int argc, char **argv) {
     run_thread(th_reference, TH_REF, &t0, &thr_ref);
     run_thread(th_ui, TH_UI, &t0, &thr_ui);
 
-    if (with_load) run_thread(th_load, TH_LOAD, &t0, &thr_load);
+    Stress *load = NULL;
+    if (with_load && !(load = stress_start(&stress_cfg)))
+        fprintf(stderr, "Aviso: carga não iniciada; seguindo sem carga\n");
 
     while (now_since_t0(&t0) < SIM_SECONDS && !get_stop()) {
         struct timespec ts = {.tv_sec=0, .tv_nsec=10000000L}; // 10 ms
@@ -54,7 +90,10 @@ int main(int argc, char **argv) {
     pthread_join(thr_my, NULL);
     pthread_join(thr_ref, NULL);
     pthread_join(thr_ui, NULL);
-    if (with_load) pthread_join(thr_load, NULL);
+    if (load) {
+        StressStats sst; stress_stop(&load, &sst);
+        stress_write_config(&stress_cfg, &sst, stress_path);
+    }
 
     perf_close();
     traj_close();
@@ -50,14 +50,3 @@ void *th_ui(void *arg) {
     }
     return NULL;
 }
-
-void *th_load(void *arg) {
-    (void)arg;
-    volatile double x = 0.0;
-    while (!get_stop()) {
-        for (int i=0;i<500000;i++) { x += sin(i); }
-        struct timespec ts = {.tv_sec=0,.tv_nsec=1000000L}; // 1 ms
-        nanosleep(&ts, NULL);
-    }
-    return NULL;
-}
@@ -0,0 +1,84 @@
+#ifndef STRESS_H
+#define STRESS_H
+
+#include <pthread.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Gerador de interferência para os experimentos de jitter (lab2 e lab3).
+ * Cada thread divide cada período (STRESS_PERIOD_NS por padrão) entre
+ * trabalho e sono conforme o duty:
+ *  - cpu    : aritmética em ponto flutuante (pressão só de núcleo)
+ *  - sin    : chamadas a sin() da libm (o corpo do antigo --load do lab3)
+ *  - mem    : cópia entre duas metades de um buffer grande (banda de memória)
+ *  - cache  : escritas em linhas aleatórias de um buffer ~2x o LLC (expulsa
+ *             o cache compartilhado das outras threads)
+ *  - syscall: getppid/write em /dev/null em sequência (entradas no kernel)
+ */
+typedef enum {
+    STRESS_CPU = 0,
+    STRESS_SIN,
+    STRESS_MEM,
+    STRESS_CACHE,
+    STRESS_SYSCALL,
+    STRESS_NKINDS
+} StressKind;
+
+#define STRESS_PERIOD_NS 2000000LL // 2 ms: ciclo padrão de trabalho/sono
+
+typedef struct {
+    StressKind kind;
+    int        threads;   // nº de threads (>= 1)
+    int        duty;      // % de cada período trabalhando (1..100)
+    int        cpu;       // thread i fixada na CPU (cpu + i) % ncpus; -1 = sem afinidade
+    size_t     buf_bytes; // buffer por thread (mem/cache); 0 = padrão do tipo
+    long long  period_ns; // ciclo de trabalho/sono (> 0)
+} StressConfig;
+
+// Medido entre stress_start e stress_stop, somado entre as threads
+typedef struct {
+    double             wall_s;
+    double             busy_s;  // tempo nos laços de trabalho
+    unsigned long long ops;     // cpu: iterações; mem/cache: bytes; syscall: chamadas
+    char               cpus[256]; // afinidade efetiva por thread ("0,1,-": '-' = várias CPUs)
+} StressStats;
+
+typedef struct Stress Stress;
+
+// Padrão: 1 thread de cpu, duty 50%, ciclo de 2 ms, sem afinidade (o antigo
+// --load do lab2; o do lab3 era mais pesado, ver lab3/src/main.c).
+void stress_default(StressConfig *cfg);
+
+/**
+ * Lê "tipo[,threads=N][,duty=P][,cpu=C][,mb=M][,period_ms=T]" sobre o
+ * padrão (ex.: "mem,threads=4,duty=80,cpu=0"). Retorna 0 ou -1 se inválido.
+ */
+int stress_parse(const char *spec, StressConfig *cfg);
+
+const char *stress_kind_name(StressKind kind);
+
+// Aloca buffers e cria as threads; NULL em falha (nada fica rodando).
+Stress *stress_start(const StressConfig *cfg);
+
+// Threads criadas (para prioridade/afinidade externas).
+int       stress_nthreads(const Stress *S);
+pthread_t stress_thread(const Stress *S, int i);
+
+// Para e junta as threads, libera tudo e zera *S; st pode ser NULL.
+void stress_stop(Stress **S, StressStats *st);
+
+/**
+ * Grava a configuração (e, se st != NULL, o que foi medido) em 'path',
+ * uma chave=valor por linha, para ficar junto dos resultados de jitter.
+ */
+int stress_write_config(const StressConfig *cfg, const StressStats *st, const char *path);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // STRESS_H
@@ -0,0 +1,303 @@
+// stress.c
+// Threads de interferência (cpu, banda de memória, cache, syscalls) com
+// duty cycle e afinidade configuráveis, compartilhadas por lab2 e lab3.
+
+// --- Feature test macros ---
+#define _GNU_SOURCE // pthread_setaffinity_np, CPU_SET, _SC_LEVEL3_CACHE_SIZE
+
+#include "stress.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <math.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#define MiB ((size_t)1 << 20)
+
+#define STRESS_MEM_DEFAULT   (64 * MiB) // bem maior que qualquer LLC
+#define STRESS_LLC_FALLBACK  (8 * MiB)  // se o sysconf não souber o L3
+#define STRESS_MEM_CHUNK     (256 * 1024)
+#define STRESS_LINE          64
+
+static const char *KIND_NAME[STRESS_NKINDS] = {"cpu", "sin", "mem", "cache", "syscall"};
+
+typedef struct {
+    Stress            *S;
+    pthread_t          th;
+    unsigned char     *buf;
+    size_t             len;
+    size_t             pos;      // mem: deslocamento da próxima cópia
+    uint64_t           rng;      // cache: xorshift das linhas
+    int                fd_null;  // syscall
+    long long          busy_ns;
+    unsigned long long ops;
+} Worker;
+
+struct Stress {
+    StressConfig cfg;
+    atomic_int   run;
+    int          n;        // threads criadas
+    Worker      *w;
+    long long    t0_ns;
+};
+
+static inline long long mono_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (long long)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+static void sleep_abs(long long ns) {
+    struct timespec ts = {.tv_sec = ns / 1000000000LL, .tv_nsec = ns % 1000000000LL};
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR)
+        ;
+}
+
+static size_t llc_bytes(void) {
+    long v = sysconf(_SC_LEVEL3_CACHE_SIZE);
+    if (v <= 0) v = sysconf(_SC_LEVEL2_CACHE_SIZE);
+    return v > 0 ? (size_t)v : STRESS_LLC_FALLBACK;
+}
+
+// ----------------- Núcleos de trabalho (um bloco de dezenas de µs) -----------------
+
+static unsigned long long work_cpu(Worker *w) {
+    (void)w;
+    volatile double x = 0.0;
+    for (int i = 0; i < 20000; ++i) x += i * 0.000001;
+    return 20000;
+}
+
+static unsigned long long work_sin(Worker *w) {
+    (void)w;
+    volatile double x = 0.0;
+    for (int i = 0; i < 2000; ++i) x += sin(i);
+    return 2000;
+}
+
+static unsigned long long work_mem(Worker *w) {
+    size_t half = w->len / 2;
+    if (w->pos + STRESS_MEM_CHUNK > half) w->pos = 0;
+    memcpy(w->buf + half + w->pos, w->buf + w->pos, STRESS_MEM_CHUNK);
+    w->pos += STRESS_MEM_CHUNK;
+    return 2 * STRESS_MEM_CHUNK; // lido + escrito
+}
+
+static unsigned long long work_cache(Worker *w) {
+    size_t lines = w->len / STRESS_LINE;
+    uint64_t r = w->rng;
+    for (int i = 0; i < 4096; ++i) {
+        r ^= r << 13; r ^= r >> 7; r ^= r << 17;
+        w->buf[(r % lines) * STRESS_LINE]++;
+    }
+    w->rng = r;
+    return 4096 * STRESS_LINE;
+}
+
+static unsigned long long work_syscall(Worker *w) {
+    char c = 0;
+    for (int i = 0; i < 64; ++i) {
+        (void)getppid();
+        if (write(w->fd_null, &c, 1) < 0) break;
+    }
+    return 128;
+}
+
+typedef unsigned long long (*WorkFn)(Worker *);
+static const WorkFn WORK[STRESS_NKINDS] = {work_cpu, work_sin, work_mem, work_cache, work_syscall};
+
+static void *worker_fn(void *arg) {
+    Worker *w = (Worker *)arg;
+    Stress *S = w->S;
+    WorkFn work = WORK[S->cfg.kind];
+    const long long busy_len = S->cfg.period_ns * S->cfg.duty / 100;
+
+    long long period = mono_ns();
+    while (atomic_load_explicit(&S->run, memory_order_relaxed)) {
+        long long b0 = mono_ns(), t;
+        do {
+            w->ops += work(w);
+        } while ((t = mono_ns()) < period + busy_len &&
+                 atomic_load_explicit(&S->run, memory_order_relaxed));
+        w->busy_ns += t - b0;
+
+        // Próximo período; se atrasou (ex.: preempção), recomeça do agora
+        period += S->cfg.period_ns;
+        if (S->cfg.duty < 100 && period > t) sleep_abs(period);
+        else period = t;
+    }
+    return NULL;
+}
+
+// ----------------- Configuração -----------------
+
+void stress_default(StressConfig *cfg) {
+    cfg->kind = STRESS_CPU;
+    cfg->threads = 1;
+    cfg->duty = 50;
+    cfg->cpu = -1;
+    cfg->buf_bytes = 0;
+    cfg->period_ns = STRESS_PERIOD_NS;
+}
+
+const char *stress_kind_name(StressKind kind) {
+    return (kind >= 0 && kind < STRESS_NKINDS) ? KIND_NAME[kind] : "?";
+}
+
+int stress_parse(const char *spec, StressConfig *cfg) {
+    char tmp[128];
+    if (strlen(spec) >= sizeof(tmp)) return -1;
+    strcpy(tmp, spec);
+
+    char *save = NULL;
+    char *tok = strtok_r(tmp, ",", &save);
+    if (!tok) return -1;
+    int k = 0;
+    while (k < STRESS_NKINDS && strcmp(tok, KIND_NAME[k]) != 0) ++k;
+    if (k == STRESS_NKINDS) return -1;
+    cfg->kind = (StressKind)k;
+
+    while ((tok = strtok_r(NULL, ",", &save)) != NULL) {
+        char *eq = strchr(tok, '=');
+        if (!eq) return -1;
+        *eq = '\0';
+        char *end = NULL;
+        long v = strtol(eq + 1, &end, 10);
+        if (*end != '\0' || end == eq + 1) return -1;
+        if (strcmp(tok, "threads") == 0 && v >= 1 && v <= 1024) cfg->threads = (int)v;
+        else if (strcmp(tok, "duty") == 0 && v >= 1 && v <= 100) cfg->duty = (int)v;
+        else if (strcmp(tok, "cpu") == 0 && v >= -1) cfg->cpu = (int)v;
+        else if (strcmp(tok, "mb") == 0 && v >= 1) cfg->buf_bytes = (size_t)v * MiB;
+        else if (strcmp(tok, "period_ms") == 0 && v >= 1 && v <= 1000) cfg->period_ns = v * 1000000LL;
+        else return -1;
+    }
+    return 0;
+}
+
+// ----------------- Ciclo de vida -----------------
+
+static size_t buf_len(const StressConfig *cfg) {
+    if (cfg->kind == STRESS_MEM) return cfg->buf_bytes ? cfg->buf_bytes : STRESS_MEM_DEFAULT;
+    if (cfg->kind == STRESS_CACHE) return cfg->buf_bytes ? cfg->buf_bytes : 2 * llc_bytes();
+    return 0;
+}
+
+static void worker_free(Worker *w) {
+    free(w->buf);
+    if (w->fd_null >= 0) close(w->fd_null);
+}
+
+Stress *stress_start(const StressConfig *cfg) {
+    if (cfg->threads < 1 || cfg->duty < 1 || cfg->duty > 100 || cfg->period_ns <= 0 ||
+        cfg->kind < 0 || cfg->kind >= STRESS_NKINDS)
+        return NULL;
+
+    Stress *S = calloc(1, sizeof(*S));
+    if (!S) return NULL;
+    S->cfg = *cfg;
+    S->w = calloc((size_t)cfg->threads, sizeof(Worker));
+    if (!S->w) { free(S); return NULL; }
+    atomic_init(&S->run, 1);
+
+    long ncpu = sysconf(_SC_NPROCESSORS_ONLN);
+    if (ncpu < 1) ncpu = 1;
+    size_t len = buf_len(cfg);
+    S->t0_ns = mono_ns();
+
+    for (int i = 0; i < cfg->threads; ++i) {
+        Worker *w = &S->w[i];
+        w->S = S;
+        w->fd_null = -1;
+        w->rng = 0x9E3779B97F4A7C15ULL ^ (uint64_t)(i + 1);
+        if (len > 0) {
+            // Buffer tocado antes de começar: as faltas de página não entram na medição
+            w->buf = malloc(len);
+            if (!w->buf) goto fail;
+            memset(w->buf, 1, len);
+            w->len = len;
+        }
+        if (cfg->kind == STRESS_SYSCALL) {
+            w->fd_null = open("/dev/null", O_WRONLY);
+            if (w->fd_null < 0) goto fail;
+        }
+        if (pthread_create(&w->th, NULL, worker_fn, w) != 0) goto fail;
+        S->n++;
+        if (cfg->cpu >= 0) {
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            CPU_SET((cfg->cpu + i) % ncpu, &set);
+            pthread_setaffinity_np(w->th, sizeof(set), &set); // melhor esforço
+        }
+    }
+    return S;
+
+fail:
+    worker_free(&S->w[S->n]); // o que falhou; os anteriores já rodam
+    stress_stop(&S, NULL);
+    return NULL;
+}
+
+int stress_nthreads(const Stress *S) {
+    return S->n;
+}
+
+pthread_t stress_thread(const Stress *S, int i) {
+    return S->w[i].th;
+}
+
+void stress_stop(Stress **pS, StressStats *st) {
+    Stress *S = *pS;
+    if (!S) return;
+
+    // Afinidade efetiva antes do join: quem chamou pode ter mudado depois do start
+    StressStats acc = {0};
+    size_t len = 0;
+    for (int i = 0; i < S->n && len < sizeof(acc.cpus) - 8; ++i) {
+        cpu_set_t set;
+        int cpu = -1;
+        if (pthread_getaffinity_np(S->w[i].th, sizeof(set), &set) == 0 && CPU_COUNT(&set) == 1)
+            for (int c = 0; c < CPU_SETSIZE && cpu < 0; ++c)
+                if (CPU_ISSET(c, &set)) cpu = c;
+        len += (size_t)snprintf(acc.cpus + len, sizeof(acc.cpus) - len, cpu >= 0 ? "%s%d" : "%s-",
+                                i ? "," : "", cpu);
+    }
+    atomic_store(&S->run, 0);
+    for (int i = 0; i < S->n; ++i) {
+        pthread_join(S->w[i].th, NULL);
+        acc.busy_s += S->w[i].busy_ns / 1e9;
+        acc.ops += S->w[i].ops;
+    }
+    acc.wall_s = (mono_ns() - S->t0_ns) / 1e9;
+    if (st) *st = acc;
+
+    for (int i = 0; i < S->n; ++i) worker_free(&S->w[i]);
+    free(S->w);
+    free(S);
+    *pS = NULL;
+}
+
+int stress_write_config(const StressConfig *cfg, const StressStats *st, const char *path) {
+    FILE *fp = fopen(path, "w");
+    if (!fp) {
+        perror(path);
+        return -1;
+    }
+    fprintf(fp, "kind=%s\nthreads=%d\nduty_pct=%d\ncpu=%d\nbuf_bytes=%zu\nperiod_ns=%lld\n",
+            stress_kind_name(cfg->kind), cfg->threads, cfg->duty, cfg->cpu,
+            buf_len(cfg), cfg->period_ns);
+    if (st && st->cpus[0]) fprintf(fp, "cpus_effective=%s\n", st->cpus);
+    if (st && st->wall_s > 0.0) {
+        fprintf(fp, "wall_s=%.3f\nbusy_s=%.3f\nduty_measured_pct=%.1f\nops=%llu\nops_per_s=%.4g\n",
+                st->wall_s, st->busy_s, 100.0 * st->busy_s / (st->wall_s * cfg->threads),
+                st->ops, st->ops / st->wall_s);
+    }
+    fclose(fp);
+    return 0;
+}